@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <iostream>
+#include <functional>
+
+namespace saucer::bench
+{
+    //? Runs the given callback `iterations` times and prints the average duration of a single run.
+
+    inline void run(const std::string &name, std::size_t iterations, const std::function<void()> &callback)
+    {
+        using clock = std::chrono::steady_clock;
+
+        callback();
+
+        const auto start = clock::now();
+
+        for (auto i = 0u; iterations > i; i++)
+        {
+            callback();
+        }
+
+        const auto elapsed = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+        std::cout << name << ": " << (elapsed / static_cast<double>(iterations)) << "us" << std::endl;
+    }
+} // namespace saucer::bench
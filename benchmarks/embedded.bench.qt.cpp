@@ -0,0 +1,68 @@
+#include "bench.hpp"
+#include "span_device.qt.hpp"
+
+#include <span>
+#include <vector>
+#include <cstdint>
+
+#include <QBuffer>
+
+namespace
+{
+    //? QtWebEngine pulls the reply device in chunks, this mimics it closely enough to compare both devices.
+
+    constexpr auto chunk_size = 64 * 1024;
+
+    struct asset_set
+    {
+        std::vector<std::vector<std::uint8_t>> files;
+
+      public:
+        asset_set(std::size_t count, std::size_t size) : files(count, std::vector<std::uint8_t>(size, 0x2A)) {}
+    };
+
+    void consume(QIODevice &device)
+    {
+        static thread_local std::vector<char> sink(chunk_size);
+
+        while (device.read(sink.data(), chunk_size) > 0)
+        {
+        }
+    }
+
+    void copied(const asset_set &assets)
+    {
+        for (const auto &file : assets.files)
+        {
+            QBuffer buffer;
+
+            buffer.open(QIODevice::WriteOnly);
+            buffer.write(reinterpret_cast<const char *>(file.data()), static_cast<qint64>(file.size()));
+            buffer.close();
+
+            buffer.open(QIODevice::ReadOnly);
+            consume(buffer);
+        }
+    }
+
+    void in_place(const asset_set &assets)
+    {
+        for (const auto &file : assets.files)
+        {
+            saucer::span_device device{std::span{file}};
+            consume(device);
+        }
+    }
+} // namespace
+
+void embedded_benchmarks()
+{
+    const asset_set small{4000, 2 * 1024};
+    const asset_set large{4, 8 * 1024 * 1024};
+
+    saucer::bench::run("QBuffer copy (4000 x 2 KiB)", 20, [&] { copied(small); });
+    saucer::bench::run("span_device (4000 x 2 KiB)", 20, [&] { in_place(small); });
+
+    saucer::bench::run("QBuffer copy (4 x 8 MiB)", 20, [&] { copied(large); });
+    saucer::bench::run("span_device (4 x 8 MiB)", 20, [&] { in_place(large); });
+}
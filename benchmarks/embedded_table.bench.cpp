@@ -0,0 +1,67 @@
+#include "bench.hpp"
+#include "webview.hpp"
+
+#include <map>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr auto files = 4000u;
+
+    //? Mirrors the scheme handler: every request looks up one path out of a bundle of `files` assets.
+
+    std::vector<std::string> paths()
+    {
+        std::vector<std::string> rtn;
+        rtn.reserve(files);
+
+        for (auto i = 0u; files > i; i++)
+        {
+            rtn.emplace_back("src/components/" + std::to_string(i) + "/index.js");
+        }
+
+        return rtn;
+    }
+} // namespace
+
+void embedded_table_benchmarks()
+{
+    static const auto names = paths();
+    static constexpr std::array<std::uint8_t, 1> content{0};
+
+    std::map<std::string, saucer::embedded_file, std::less<>> map;
+    static std::array<saucer::embedded_entry, files> entries;
+
+    for (auto i = 0u; files > i; i++)
+    {
+        map.emplace(names[i], saucer::embedded_file{"application/javascript", content});
+        entries[i] = {names[i], "application/javascript", content};
+    }
+
+    static const auto storage = saucer::make_embedded_table(entries);
+    const saucer::embedded_table table = storage;
+
+    std::size_t found{};
+
+    saucer::bench::run("std::map lookup", 20,
+                       [&]
+                       {
+                           for (const auto &name : names)
+                           {
+                               found += map.find(std::string_view{name}) != map.end();
+                           }
+                       });
+
+    saucer::bench::run("embedded_table lookup", 20,
+                       [&]
+                       {
+                           for (const auto &name : names)
+                           {
+                               found += table.find(name) != nullptr;
+                           }
+                       });
+
+    std::cout << "(found " << found << ")" << std::endl;
+}
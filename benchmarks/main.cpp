@@ -0,0 +1,20 @@
+#include "bench.hpp"
+
+void slot_map_benchmarks();
+void embedded_table_benchmarks();
+
+#if defined(SAUCER_QT5) || defined(SAUCER_QT6)
+void embedded_benchmarks();
+#endif
+
+int main()
+{
+    slot_map_benchmarks();
+    embedded_table_benchmarks();
+
+#if defined(SAUCER_QT5) || defined(SAUCER_QT6)
+    embedded_benchmarks();
+#endif
+
+    return 0;
+}
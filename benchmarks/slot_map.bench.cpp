@@ -0,0 +1,73 @@
+#include "bench.hpp"
+#include "slot_map.hpp"
+
+#include <map>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <lockpp/lock.hpp>
+
+namespace
+{
+    constexpr auto threads    = 4u;
+    constexpr auto operations = 10'000u;
+
+    //? Mirrors the access pattern of evaluations: every thread inserts an entry and takes it again shortly after.
+
+    template <typename Callback>
+    void spawn(const Callback &callback)
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+
+        for (auto i = 0u; threads > i; i++)
+        {
+            workers.emplace_back(callback);
+        }
+
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    void locked_map()
+    {
+        lockpp::lock<std::map<std::uint64_t, std::function<void()>>> map;
+        std::atomic_uint64_t counter{0};
+
+        spawn(
+            [&]
+            {
+                for (auto i = 0u; operations > i; i++)
+                {
+                    auto id = counter++;
+
+                    map.write()->emplace(id, [] {});
+                    map.write()->erase(id);
+                }
+            });
+    }
+
+    void sharded_slot_map()
+    {
+        saucer::slot_map<std::function<void()>> map;
+
+        spawn(
+            [&]
+            {
+                for (auto i = 0u; operations > i; i++)
+                {
+                    auto id = map.insert([] {});
+                    map.take(id);
+                }
+            });
+    }
+} // namespace
+
+void slot_map_benchmarks()
+{
+    saucer::bench::run("lock<std::map> insert/erase", 20, locked_map);
+    saucer::bench::run("slot_map insert/take", 20, sharded_slot_map);
+}
@@ -0,0 +1,131 @@
+# --------------------------------------------------------------------------------------------------------
+# saucer_embed(<target> DIRECTORY <dir> [NAME <name>] [PATTERNS <globs>...] [COMPRESS])
+# └ Packs all files of <dir> that match <globs> (default: all files) into a single, aligned blob that is
+#   linked into <target> (through `.incbin`, or a generated array on MSVC). Identical files are stored once.
+#   With COMPRESS, files that shrink noticeably are stored brotli compressed and decoded on first request
+#   (requires `saucer_brotli`).
+#   The generated header <saucer/embedded/<name>.hpp> (default name: "all") provides
+#   `saucer::embedded::<name>()`, which returns an `embedded_table` that can be passed to `webview::embed`.
+#   The exported symbols are derived from both <target> and <name>, so several targets that are linked
+#   together may each embed a directory under the same name.
+#
+#   The files are packed by `saucer_embed_tool`, which runs at build time. When cross compiling it is run
+#   through CMAKE_CROSSCOMPILING_EMULATOR, or `saucer_embed_executable` may point to a build of
+#   "tools/embed" for the host (i.e. `cmake -S tools/embed -B <dir>` with the host toolchain).
+# --------------------------------------------------------------------------------------------------------
+
+function(saucer_embed target)
+  cmake_parse_arguments(PARSE_ARGV 1 embed "COMPRESS" "DIRECTORY;NAME" "PATTERNS")
+
+  if (NOT embed_DIRECTORY)
+    message(FATAL_ERROR "[saucer] saucer_embed: DIRECTORY is required")
+  endif()
+
+  if (NOT embed_NAME)
+    set(embed_NAME "all")
+  endif()
+
+  if (NOT embed_NAME MATCHES "^[a-zA-Z_][a-zA-Z0-9_]*$")
+    message(FATAL_ERROR "[saucer] saucer_embed: NAME must be a valid C++ identifier, got '${embed_NAME}'")
+  endif()
+
+  if (embed_COMPRESS AND NOT TARGET brotlienc)
+    message(FATAL_ERROR "[saucer] saucer_embed: COMPRESS requires saucer to be built with 'saucer_brotli'")
+  endif()
+
+  if (NOT embed_PATTERNS)
+    set(embed_PATTERNS "*")
+  endif()
+
+  get_filename_component(directory "${embed_DIRECTORY}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+  list(TRANSFORM embed_PATTERNS PREPEND "${directory}/" OUTPUT_VARIABLE globs)
+
+  file(GLOB_RECURSE files LIST_DIRECTORIES false RELATIVE "${directory}" CONFIGURE_DEPENDS ${globs})
+  list(SORT files)
+  list(TRANSFORM files PREPEND "${directory}/" OUTPUT_VARIABLE dependencies)
+
+  # ------------------------------------------------------------------------------------------------------
+  # The file list is only rewritten when it changes, so that re-configuring does not re-run the embedding.
+  # ------------------------------------------------------------------------------------------------------
+
+  set(output "${CMAKE_CURRENT_BINARY_DIR}/saucer-embed/${target}/${embed_NAME}")
+  set(list   "${output}/files.txt")
+
+  string(JOIN "\n" content ${files})
+
+  if (EXISTS "${list}")
+    file(READ "${list}" previous)
+  endif()
+
+  if (NOT previous STREQUAL content)
+    file(WRITE "${list}" "${content}")
+  endif()
+
+  # ------------------------------------------------------------------------------------------------------
+  # Setup generator
+  # ------------------------------------------------------------------------------------------------------
+
+  if (saucer_embed_executable)
+    set(tool "${saucer_embed_executable}")
+  elseif (CMAKE_CROSSCOMPILING AND NOT CMAKE_CROSSCOMPILING_EMULATOR)
+    message(FATAL_ERROR "[saucer] saucer_embed: The embed tool can not run on the build machine when cross "
+                        "compiling, set 'saucer_embed_executable' to a host build of 'tools/embed' or set "
+                        "CMAKE_CROSSCOMPILING_EMULATOR")
+  else()
+    set(tool saucer_embed_tool)
+  endif()
+
+  if (tool STREQUAL "saucer_embed_tool" AND NOT TARGET saucer_embed_tool)
+    add_executable(saucer_embed_tool "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../tools/embed/main.cpp")
+
+    target_compile_features(saucer_embed_tool PRIVATE cxx_std_20)
+    set_target_properties(saucer_embed_tool PROPERTIES CXX_STANDARD 20 CXX_EXTENSIONS OFF CXX_STANDARD_REQUIRED ON)
+
+    target_include_directories(saucer_embed_tool PRIVATE "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../include")
+
+    if (TARGET brotlienc)
+      target_link_libraries(saucer_embed_tool PRIVATE brotlienc)
+      target_compile_definitions(saucer_embed_tool PRIVATE SAUCER_EMBED_BROTLI)
+    endif()
+  endif()
+
+  set(mode incbin)
+
+  if (MSVC)
+    set(mode array)
+  endif()
+
+  set(encoding identity)
+
+  if (embed_COMPRESS)
+    set(encoding brotli)
+  endif()
+
+  string(MAKE_C_IDENTIFIER "${target}" identifier)
+  string(SHA1 hash "${target}/${embed_NAME}")
+  string(SUBSTRING "${hash}" 0 8 hash)
+
+  set(symbol "saucer_embedded_${identifier}_${embed_NAME}_${hash}")
+
+  set(blob   "${output}/blob.bin")
+  set(source "${output}/${embed_NAME}.cpp")
+  set(header "${output}/include/saucer/embedded/${embed_NAME}.hpp")
+
+  add_custom_command(
+    OUTPUT     "${output}/stamp"
+    BYPRODUCTS "${blob}" "${source}" "${header}"
+    COMMAND    ${tool} "${embed_NAME}" "${symbol}" "${directory}" "${list}" "${output}" "${mode}" "${encoding}"
+    COMMAND    "${CMAKE_COMMAND}" -E touch "${output}/stamp"
+    DEPENDS    ${tool} "${list}" ${dependencies}
+    COMMENT    "[saucer] Embedding '${embed_DIRECTORY}' as '${embed_NAME}'"
+    VERBATIM
+  )
+
+  add_custom_target(${target}_embed_${embed_NAME} DEPENDS "${output}/stamp")
+  add_dependencies(${target} ${target}_embed_${embed_NAME})
+
+  set_source_files_properties("${source}" PROPERTIES GENERATED ON OBJECT_DEPENDS "${blob}")
+
+  target_sources(${target} PRIVATE "${source}")
+  target_include_directories(${target} PRIVATE "${output}/include")
+endfunction()
@@ -1,26 +0,0 @@
-#pragma once
-#include <array>
-#include <cstdint>
-
-namespace saucer::embedded
-{
-    inline constexpr std::array<std::uint8_t, 318> src_index_html = {
-        0x20, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa,  0x3c,
-        0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa,  0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xa,  0x20,
-        0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x45, 0x78, 0x61, 0x6d,
-        0x70, 0x6c, 0x65, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0xa,  0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-        0x20, 0x20, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65,
-        0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2e, 0x2e, 0x2f, 0x73, 0x74,
-        0x79, 0x6c, 0x65, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0xa,  0x20, 0x20,
-        0x20, 0x20, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0xa,  0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x6f, 0x64,
-        0x79, 0x3e, 0xa,  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6d, 0x67, 0x20, 0x73, 0x72,
-        0x63, 0x3d, 0x22, 0x2e, 0x2e, 0x2f, 0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x2f, 0x6c, 0x6f, 0x67, 0x6f, 0x2e,
-        0x70, 0x6e, 0x67, 0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x31, 0x35, 0x30, 0x20, 0x2f, 0x3e,
-        0xa,  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69,
-        0x73, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e,
-        0x20, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x70, 0x61, 0x67,
-        0x65, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0xa,  0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e,
-        0xa,  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3d,
-        0x22, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x6a, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70,
-        0x74, 0x3e, 0x20, 0xa,  0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0xa};
-} // namespace saucer::embedded
@@ -1,14 +0,0 @@
-#pragma once
-#include <array>
-#include <cstdint>
-
-namespace saucer::embedded
-{
-    inline constexpr std::array<std::uint8_t, 97> style_style_css = {
-        0x69, 0x6d, 0x67, 0x20, 0x7b, 0xa,  0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20,
-        0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0xa,  0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c,
-        0x65, 0x66, 0x74, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0xa,  0x20, 0x20, 0x6d, 0x61, 0x72, 0x67,
-        0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0xa,  0x7d,
-        0xa,  0xa,  0x70, 0x20, 0x7b, 0xa,  0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e,
-        0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0xa,  0x7d, 0xa};
-} // namespace saucer::embedded
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "window.hpp"
+#include "utils/policy.hpp"
+
+#include <mutex>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace saucer
+{
+    //? Collects the setup of a view (usually a smartview) before the view exists, so that the initialization of the
+    //? application does not have to wait for the engine. Other threads may expose functions and queue loads at any
+    //? time, work that is queued before the view is created is replayed in order once it is, later work is forwarded
+    //? to the view directly.
+    //?
+    //? The engine has to be brought up on the thread that runs the event loop, which is what `create` does. To overlap
+    //? both, start the initialization of the application on another thread first and hand it the `deferred`.
+    //? The `deferred` must not be used anymore once the view it created was destroyed.
+
+    template <typename T>
+    class deferred
+    {
+        using callback = std::function<void(T &)>;
+
+      private:
+        struct state
+        {
+            std::mutex mutex;
+            std::vector<callback> queued;
+
+          public:
+            bool created{false};
+            T *instance{nullptr};
+        };
+
+      private:
+        std::shared_ptr<state> m_state;
+
+      private:
+        std::promise<T *> m_promise;
+        std::shared_future<T *> m_future;
+
+      public:
+        deferred();
+
+      public:
+        [[sc::thread_safe]] void then(callback callback);
+
+      public:
+        template <typename Function>
+        [[sc::thread_safe]] void expose(std::string name, Function func, policy policy = policies::ui{},
+                                        priority priority = priority::normal);
+
+      public:
+        [[sc::thread_safe]] void set_url(std::string url);
+        [[sc::thread_safe]] void serve(std::string file);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::shared_future<T *> ready() const;
+
+      public:
+        //? Creates the view on the calling thread, replays the queued work and then fulfills `ready`. Can only be
+        //? called once, later calls throw a `std::future_error` without creating a view. If the creation or the
+        //? replay throws, the exception is forwarded to `ready` and rethrown.
+        [[nodiscard]] std::unique_ptr<T> create(const options & = {});
+    };
+} // namespace saucer
+
+#include "deferred.inl"
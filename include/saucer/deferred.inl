@@ -0,0 +1,119 @@
+#pragma once
+
+#include "deferred.hpp"
+
+#include <utility>
+
+namespace saucer
+{
+    template <typename T>
+    deferred<T>::deferred() : m_state(std::make_shared<state>()), m_future(m_promise.get_future().share())
+    {
+    }
+
+    template <typename T>
+    void deferred<T>::then(callback callback)
+    {
+        T *instance{};
+
+        {
+            std::lock_guard guard{m_state->mutex};
+
+            if (!m_state->instance)
+            {
+                m_state->queued.emplace_back(std::move(callback));
+                return;
+            }
+
+            instance = m_state->instance;
+        }
+
+        callback(*instance);
+    }
+
+    template <typename T>
+    template <typename Function>
+    void deferred<T>::expose(std::string name, Function func, policy policy, priority priority)
+    {
+        then([name = std::move(name), func = std::move(func), policy = std::move(policy), priority](T &view)
+             { view.expose(name, func, policy, priority); });
+    }
+
+    template <typename T>
+    void deferred<T>::set_url(std::string url)
+    {
+        then([url = std::move(url)](T &view) { view.set_url(url); });
+    }
+
+    template <typename T>
+    void deferred<T>::serve(std::string file)
+    {
+        then([file = std::move(file)](T &view) { view.serve(file); });
+    }
+
+    template <typename T>
+    std::shared_future<T *> deferred<T>::ready() const
+    {
+        return m_future;
+    }
+
+    template <typename T>
+    std::unique_ptr<T> deferred<T>::create(const options &options)
+    {
+        {
+            std::lock_guard guard{m_state->mutex};
+
+            if (std::exchange(m_state->created, true))
+            {
+                throw std::future_error{std::future_errc::promise_already_satisfied};
+            }
+        }
+
+        std::unique_ptr<T> rtn;
+
+        try
+        {
+            rtn = std::make_unique<T>(options);
+
+            //? Work that is queued while replaying is replayed as well, the view is only published once the queue is
+            //? drained so that the order in which work was queued is kept.
+
+            while (true)
+            {
+                std::vector<callback> queued;
+
+                {
+                    std::lock_guard guard{m_state->mutex};
+
+                    if (m_state->queued.empty())
+                    {
+                        m_state->instance = rtn.get();
+                        break;
+                    }
+
+                    queued = std::exchange(m_state->queued, {});
+                }
+
+                for (auto &callback : queued)
+                {
+                    callback(*rtn);
+                }
+            }
+        }
+        catch (...)
+        {
+            //? The view is destroyed on the way out, work that is still queued can not be run anymore.
+            {
+                std::lock_guard guard{m_state->mutex};
+                m_state->queued.clear();
+            }
+
+            m_promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        m_promise.set_value(rtn.get());
+
+        return rtn;
+    }
+} // namespace saucer
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "window.hpp"
+
+#include <deque>
+#include <memory>
+#include <cstddef>
+
+namespace saucer
+{
+    //? Keeps up to `size` hidden views (usually smartviews) around, so that secondary windows can be shown without
+    //? waiting for the engine. Every pooled view already has its bridge injected and has loaded a blank page, which
+    //? starts its renderer process. The pool builds its first view on construction, the remaining ones, like those that
+    //? replace views taken out of the pool, are created on the UI thread in the background, one view per iteration of
+    //? the event loop so that the UI stays responsive.
+    //?
+    //? The pool has to be created and used on the UI thread. Views are only created for as long as the pool exists.
+
+    template <typename T>
+    class view_pool
+    {
+        struct state
+        {
+            std::size_t size;
+            saucer::options options;
+
+          public:
+            std::deque<std::unique_ptr<T>> views;
+        };
+
+      private:
+        std::shared_ptr<state> m_state;
+
+      private:
+        static std::unique_ptr<T> make(const state &);
+
+      private:
+        static void refill(const std::weak_ptr<state> &);
+        static void schedule(const std::shared_ptr<state> &, T &);
+
+      public:
+        view_pool(std::size_t size, const options & = {});
+
+      public:
+        //? Returns a pooled view if one is available and creates one otherwise.
+        [[nodiscard]] std::unique_ptr<T> acquire();
+
+      public:
+        void resize(std::size_t size);
+        [[nodiscard]] std::size_t available() const;
+    };
+} // namespace saucer
+
+#include "pool.inl"
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "pool.hpp"
+
+namespace saucer
+{
+    template <typename T>
+    std::unique_ptr<T> view_pool<T>::make(const state &state)
+    {
+        auto rtn = std::make_unique<T>(state.options);
+        rtn->set_url("about:blank");
+
+        return rtn;
+    }
+
+    template <typename T>
+    void view_pool<T>::refill(const std::weak_ptr<state> &weak)
+    {
+        auto state = weak.lock();
+
+        if (!state || state->views.size() >= state->size)
+        {
+            return;
+        }
+
+        state->views.emplace_back(make(*state));
+        schedule(state, *state->views.back());
+    }
+
+    template <typename T>
+    void view_pool<T>::schedule(const std::shared_ptr<state> &state, T &scheduler)
+    {
+        //? Callbacks of a destroyed window are dropped, which is why the pool prefers to schedule through one of its own
+        //? views. A refill that got dropped is picked up again by the next call to `acquire`.
+
+        auto &target = state->views.empty() ? scheduler : *state->views.back();
+        target.dispatch([weak = std::weak_ptr{state}] { refill(weak); });
+    }
+
+    template <typename T>
+    view_pool<T>::view_pool(std::size_t size, const options &options)
+        : m_state(std::make_shared<state>(state{size, options, {}}))
+    {
+        if (size == 0)
+        {
+            return;
+        }
+
+        //? Only the first view is built right away, so that creating a large pool does not stall the UI thread.
+
+        m_state->views.emplace_back(make(*m_state));
+        schedule(m_state, *m_state->views.back());
+    }
+
+    template <typename T>
+    std::unique_ptr<T> view_pool<T>::acquire()
+    {
+        std::unique_ptr<T> rtn;
+
+        if (m_state->views.empty())
+        {
+            rtn = make(*m_state);
+        }
+        else
+        {
+            rtn = std::move(m_state->views.front());
+            m_state->views.pop_front();
+        }
+
+        if (m_state->size > 0)
+        {
+            schedule(m_state, *rtn);
+        }
+
+        return rtn;
+    }
+
+    template <typename T>
+    void view_pool<T>::resize(std::size_t size)
+    {
+        m_state->size = size;
+
+        while (m_state->views.size() > size)
+        {
+            m_state->views.pop_back();
+        }
+
+        if (m_state->views.size() == size)
+        {
+            return;
+        }
+
+        if (m_state->views.empty())
+        {
+            m_state->views.emplace_back(make(*m_state));
+        }
+
+        schedule(m_state, *m_state->views.back());
+    }
+
+    template <typename T>
+    std::size_t view_pool<T>::available() const
+    {
+        return m_state->views.size();
+    }
+} // namespace saucer
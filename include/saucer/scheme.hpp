@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <span>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+namespace saucer
+{
+    struct scheme_request
+    {
+        std::string url;
+        std::string path;
+        std::string method;
+        std::map<std::string, std::string> headers;
+    };
+
+    //? Streams the response of a request handler back to the page. The stream may be used from any thread and may be
+    //? kept around after the handler returned, the response is completed once `finish` is called or the last copy of the
+    //? stream is destroyed. Writing blocks while the page has not read enough of the previous data yet, and returns
+    //? `false` once the request was cancelled.
+
+    class scheme_stream
+    {
+      public:
+        struct impl;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        scheme_stream(std::shared_ptr<impl>);
+
+      public:
+        [[sc::thread_safe]] bool start(std::string_view mime);
+
+      public:
+        [[sc::thread_safe]] bool write(std::string_view data);
+        [[sc::thread_safe]] bool write(std::span<const std::uint8_t> data);
+
+      public:
+        [[sc::thread_safe]] void finish();
+        [[sc::thread_safe]] void fail();
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] bool cancelled() const;
+    };
+
+    using response_handler = std::function<void(const scheme_request &, scheme_stream)>;
+} // namespace saucer
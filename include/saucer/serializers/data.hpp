@@ -1,7 +1,10 @@
 #pragma once
 
+#include "../utils/policy.hpp"
+
 #include <string>
 #include <cstdint>
+#include <optional>
 
 namespace saucer
 {
@@ -14,10 +17,22 @@ namespace saucer
     {
         std::uint64_t id;
         std::string name;
+        std::optional<std::size_t> index;
+        std::optional<saucer::priority> priority;
     };
 
     struct result_data : message_data
     {
         std::uint64_t id;
     };
+
+    struct object_handle
+    {
+        std::uint64_t id;
+    };
+
+    struct js_handle
+    {
+        std::uint64_t id;
+    };
 } // namespace saucer
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "error.hpp"
+
+namespace saucer::errors
+{
+    class overloaded : public error
+    {
+        std::string m_function;
+
+      public:
+        ~overloaded() override;
+
+      public:
+        overloaded(std::string function);
+
+      public:
+        std::string what() override;
+    };
+} // namespace saucer::errors
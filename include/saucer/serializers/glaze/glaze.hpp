@@ -23,6 +23,7 @@ namespace saucer::serializers
       public:
         [[nodiscard]] std::string script() const override;
         [[nodiscard]] std::string js_serializer() const override;
+        [[nodiscard]] std::string js_deserializer() const override;
 
       public:
         [[nodiscard]] parse_result parse(const std::string &data) const override;
@@ -31,6 +32,9 @@ namespace saucer::serializers
         template <typename Function>
         static auto serialize(const Function &func);
 
+        template <typename T>
+        static void serialize_arg(std::string &out, const T &value, bool literal = false);
+
         template <typename... Params>
         static auto serialize_args(const Params &...params);
 
@@ -40,4 +44,23 @@ namespace saucer::serializers
     };
 } // namespace saucer::serializers
 
+template <>
+struct glz::meta<saucer::priority>
+{
+    using enum saucer::priority;
+    static constexpr auto value = enumerate("low", low, "normal", normal, "high", high);
+};
+
+template <>
+struct glz::meta<saucer::object_handle>
+{
+    static constexpr auto value = &saucer::object_handle::id;
+};
+
+template <>
+struct glz::meta<saucer::js_handle>
+{
+    static constexpr auto value = &saucer::js_handle::id;
+};
+
 #include "glaze.inl"
@@ -5,9 +5,12 @@
 #include "../errors/bad_type.hpp"
 #include "../errors/serialize.hpp"
 
+#include <utility>
+#include <iterator>
+#include <source_location>
+
 #include <fmt/args.h>
 #include <fmt/format.h>
-#include <source_location>
 
 #include <boost/callable_traits.hpp>
 
@@ -138,7 +141,8 @@ namespace saucer::serializers
                 }
             }
 
-            std::string result{"null"};
+            //? The result is returned as serialized data, the smartview hands it to the page which parses it with
+            //? `js_deserializer()`.
 
             if constexpr (!std::is_void_v<return_t>)
             {
@@ -149,56 +153,98 @@ namespace saucer::serializers
                     return tl::make_unexpected(std::make_unique<errors::serialize>());
                 }
 
-                result = std::move(serialized.value());
+                return std::move(serialized.value());
             }
             else
             {
                 std::apply(func, params);
+                return "null";
             }
-
-            auto escaped = glz::write<detail::glaze::opts>(result);
-
-            if (!escaped)
-            {
-                return tl::make_unexpected(std::make_unique<errors::serialize>());
-            }
-
-            return fmt::format("JSON.parse({})", escaped.value());
         };
     }
 
-    template <typename... Params>
-    auto glaze::serialize_args(const Params &...params)
+    template <typename T>
+    void glaze::serialize_arg(std::string &out, const T &value, bool literal)
     {
-        fmt::dynamic_format_arg_store<fmt::format_context> rtn;
+        static_assert(detail::glaze::serializable_v<T>, "All arguments must be serializable");
 
-        const auto unpack = [&]<typename T>(const T &value)
+        if constexpr (is_arguments<T>)
         {
-            static_assert(detail::glaze::serializable_v<T>, "All arguments must be serializable");
+            auto first = true;
 
-            const auto serialize = []<typename O>(const O &value)
+            [[maybe_unused]] const auto append = [&](const auto &arg)
             {
-                auto json    = glz::write<detail::glaze::opts>(value).value_or("null");
-                auto escaped = glz::write<detail::glaze::opts>(json).value_or("null");
+                if (!std::exchange(first, false))
+                {
+                    out += ", ";
+                }
 
-                return fmt::format("JSON.parse({})", escaped);
+                serialize_arg(out, arg, literal);
             };
 
-            if constexpr (is_arguments<T>)
+            std::apply([&](const auto &...args) { (append(args), ...); },
+                       static_cast<const typename T::underlying &>(value));
+        }
+        else if constexpr (std::is_same_v<T, js_handle>)
+        {
+            fmt::format_to(std::back_inserter(out), "window.saucer._lookup({})", value.id);
+        }
+        else
+        {
+            //? The value is written into buffers that are reused by every call on this thread and appended to the
+            //? script from there, so that no temporary string is allocated per argument. Unusually large values do not
+            //? keep their memory around.
+
+            static constexpr auto retained = std::size_t{64} * 1024;
+
+            thread_local std::string buffer;
+            thread_local std::string escaped;
+
+            if (glz::write<detail::glaze::opts>(value, buffer))
             {
-                using underlying = typename T::underlying;
-                auto tuple       = static_cast<underlying>(value);
+                buffer = "null";
+            }
 
-                std::vector<std::string> rtn{};
-                rtn.reserve(std::tuple_size_v<underlying>);
+            //? JSON is a valid JavaScript expression and may be used as is when a literal is requested. An object
+            //? literal however treats a `__proto__` key as the prototype of the object instead of an own property, such
+            //? values are therefore always handed to `JSON.parse`.
 
-                std::apply([&](const auto &...args) { (rtn.emplace_back(serialize(args)), ...); }, tuple);
-                return fmt::format("{}", fmt::join(rtn, ", "));
+            if (literal && buffer.find(R"("__proto__")") == std::string::npos)
+            {
+                out += buffer;
+            }
+            else if (glz::write<detail::glaze::opts>(buffer, escaped))
+            {
+                out += "null";
             }
             else
             {
-                return serialize(value);
+                out += "JSON.parse(";
+                out += escaped;
+                out += ')';
+            }
+
+            for (auto *current : {&buffer, &escaped})
+            {
+                if (current->capacity() > retained)
+                {
+                    std::string{}.swap(*current);
+                }
             }
+        }
+    }
+
+    template <typename... Params>
+    auto glaze::serialize_args(const Params &...params)
+    {
+        fmt::dynamic_format_arg_store<fmt::format_context> rtn;
+
+        const auto unpack = []<typename T>(const T &value)
+        {
+            std::string rtn;
+            serialize_arg(rtn, value);
+
+            return rtn;
         };
 
         (rtn.push_back(unpack(params)), ...);
@@ -27,8 +27,9 @@ namespace saucer
         virtual ~serializer() = default;
 
       public:
-        [[nodiscard]] virtual std::string script() const        = 0;
-        [[nodiscard]] virtual std::string js_serializer() const = 0;
+        [[nodiscard]] virtual std::string script() const          = 0;
+        [[nodiscard]] virtual std::string js_serializer() const   = 0;
+        [[nodiscard]] virtual std::string js_deserializer() const = 0;
 
       public:
         [[nodiscard]] virtual parse_result parse(const std::string &) const = 0;
@@ -41,6 +42,12 @@ namespace saucer
         { // TODO: Use lambda when https://github.com/microsoft/vscode-cpptools/issues/11624 is resolved.
             T::serialize(std::function<int()>{})
         } -> std::convertible_to<serializer::function>;
+        { //
+            T::serialize_arg(std::declval<std::string &>(), 10)
+        };
+        { //
+            T::serialize_arg(std::declval<std::string &>(), 10, true)
+        };
         { //
             T::serialize_args(10, 15, 20)
         } -> std::convertible_to<fmt::dynamic_format_arg_store<fmt::format_context>>;
@@ -2,24 +2,63 @@
 
 #include "webview.hpp"
 
+#include "utils/format.hpp"
+#include "utils/policy.hpp"
+#include "utils/exceptions.hpp"
 #include "modules/module.hpp"
 #include "serializers/glaze/glaze.hpp"
 
+#include <map>
 #include <future>
+#include <functional>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
+#include <optional>
+#include <stop_token>
 
 #include <lockpp/lock.hpp>
 
 namespace saucer
 {
+    struct serialized_event
+    {
+        std::string code;
+    };
+
+    struct evaluate_options
+    {
+        saucer::priority priority{saucer::priority::normal};
+
+      public:
+        //? Falls back to the default timeout of the smartview when not set, a timeout of zero disables it.
+        std::optional<std::chrono::milliseconds> timeout{};
+    };
+
+    struct evaluation_stats
+    {
+        std::uint64_t timed_out;
+        std::uint64_t stale;
+    };
+
+    template <typename Callable>
+    struct member
+    {
+        std::string name;
+        Callable callable;
+    };
+
+    template <typename Callable>
+    member(std::string, Callable) -> member<Callable>;
+
     class smartview_core : public webview
     {
         struct impl;
 
       private:
-        std::unique_ptr<impl> m_impl;
+        std::shared_ptr<impl> m_impl;
 
       protected:
         std::atomic_uint64_t m_id_counter{0};
@@ -34,15 +73,76 @@ namespace saucer
         bool on_message(const std::string &) override;
 
       protected:
-        [[sc::thread_safe]] void call(function_data &, const serializer::function &);
+        [[sc::thread_safe]] void call(function_data &, const serializer::function &, priority, std::uint64_t);
+        [[sc::thread_safe]] void respond(std::uint64_t, serializer::function::result_type, priority, std::uint64_t);
+
+      protected:
+        [[sc::thread_safe]] std::optional<std::size_t> add_function(std::string, serializer::function &&, const policy &,
+                                                                    priority);
+        [[sc::thread_safe]] void add_evaluation(serializer::resolver &&, std::function<void(std::exception_ptr)> &&,
+                                                const std::string &, const evaluate_options &);
+        [[sc::thread_safe]] void add_definition(const std::string &);
+        [[sc::thread_safe]] void flush_definitions();
+        [[sc::thread_safe]] void add_publication(const std::string &, std::string);
+        [[sc::thread_safe]] void add_object(std::uint64_t, std::shared_ptr<void>,
+                                            std::map<std::string, serializer::function> &&);
+        [[sc::thread_safe]] void add_handle(std::uint64_t);
+
+      protected:
+        [[sc::thread_safe]] [[nodiscard]] bool owns(const js_handle &) const;
 
       protected:
-        [[sc::thread_safe]] void add_function(std::string, serializer::function &&, bool);
-        [[sc::thread_safe]] void add_evaluation(serializer::resolver &&, const std::string &);
+        [[sc::thread_safe]] void reject(std::uint64_t, serializer::error, priority = priority::normal);
+        [[sc::thread_safe]] void resolve(std::uint64_t, const std::string &, priority = priority::normal);
 
       protected:
-        [[sc::thread_safe]] void reject(std::uint64_t, serializer::error);
-        [[sc::thread_safe]] void resolve(std::uint64_t, const std::string &);
+        [[sc::thread_safe]] void send(std::string, priority);
+
+      public:
+        //? Not named `emit`, which Qt defines as a macro unless `QT_NO_KEYWORDS` is set.
+        [[sc::thread_safe]] void send_event(const serialized_event &event);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::optional<execution_stats> statistics(const std::string &function) const;
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] admission_stats admission() const;
+        [[sc::thread_safe]] [[nodiscard]] std::optional<admission_stats> admission(const std::string &function) const;
+
+      public:
+        [[sc::thread_safe]] void set_limits(const limits &limits);
+        [[sc::thread_safe]] bool set_limits(const std::string &function, const limits &limits);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] evaluation_stats evaluation_statistics() const;
+        [[sc::thread_safe]] void set_evaluation_timeout(std::chrono::milliseconds timeout);
+
+      public:
+        //? Handlers that run off the UI thread may observe this token to stop early once the smartview shuts down.
+        [[sc::thread_safe]] [[nodiscard]] std::stop_token stop_token() const;
+
+        //? On destruction the smartview waits at most `timeout` for running calls, the names of the calls that did not
+        //? finish in time are passed to `on_abandon`.
+        [[sc::thread_safe]] void set_shutdown_timeout(
+            std::chrono::milliseconds timeout, std::function<void(const std::vector<std::string> &)> on_abandon = {});
+
+      public:
+        [[sc::thread_safe]] void set_publish_interval(std::chrono::milliseconds interval);
+
+      public:
+        //? Returns false if the handle was already released or belongs to a previous page, nothing is sent then.
+        [[sc::thread_safe]] bool release(const js_handle &handle);
+        [[sc::thread_safe]] void release(const object_handle &handle);
+
+      public:
+        //? Removes an exposed function so that its name may be exposed again, calls that already started still finish.
+        [[sc::thread_safe]] bool unexpose(const std::string &name);
+
+      public:
+        //? The callback runs at the start of the destruction of the smartview, unless it was detached before. Objects
+        //? that refer to the smartview but may outlive it (i.e. shared states) use it to let go of their reference.
+        [[sc::thread_safe]] std::uint64_t attach(std::function<void()> on_destroy);
+        [[sc::thread_safe]] void detach(std::uint64_t id);
     };
 
     using default_serializer = serializers::glaze;
@@ -54,12 +154,84 @@ namespace saucer
         smartview(const options & = {});
 
       public:
+        //? Returns false if a function with the same name was already exposed, in which case nothing is changed. The
+        //? page learns about new functions in batches, at the latest before the next script sent by the smartview.
+
         template <typename Function>
-        [[sc::thread_safe]] void expose(std::string name, const Function &func, bool async = false);
+        [[sc::thread_safe]] bool expose(std::string name, const Function &func, policy policy = policies::ui{},
+                                        priority priority = priority::normal);
+
+        template <typename Function>
+        [[sc::thread_safe]] bool expose(std::string name, const Function &func, bool async);
+
+      private:
+        template <typename Return>
+        [[nodiscard]] std::future<Return> evaluate_code(std::string code, const evaluate_options &options = {});
+
+      private:
+        template <typename... Params>
+        [[nodiscard]] bool usable(const Params &...params) const;
+
+        template <typename Return>
+        [[nodiscard]] static std::future<Return> released();
 
       public:
         template <typename Return, typename... Params>
         [[sc::thread_safe]] [[nodiscard]] std::future<Return> evaluate(const std::string &code, Params &&...params);
+
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] std::future<Return> evaluate(priority priority, const std::string &code,
+                                                                       Params &&...params);
+
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] std::future<Return> evaluate(const evaluate_options &options,
+                                                                       const std::string &code, Params &&...params);
+
+        template <typename Return, format_string Code, typename... Params>
+            requires(!std::same_as<std::remove_cvref_t<Params>, evaluate_options> && ...)
+        [[sc::thread_safe]] [[nodiscard]] std::future<Return> evaluate(Params &&...params);
+
+        template <typename Return, format_string Code, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] std::future<Return> evaluate(const evaluate_options &options,
+                                                                       Params &&...params);
+
+      public:
+        //? Calls the method of the object behind the given handle, i.e. `handle.method(params...)`.
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] std::future<Return> call(const js_handle &target, const std::string &method,
+                                                                   Params &&...params);
+
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] std::future<Return> call(const evaluate_options &options,
+                                                                   const js_handle &target, const std::string &method,
+                                                                   Params &&...params);
+
+      public:
+        using smartview_core::send_event;
+
+        template <typename... Params>
+        [[sc::thread_safe]] void send_event(const std::string &event, Params &&...params);
+
+      private:
+        template <typename Return, typename... Params>
+        std::function<std::future<Return>(Params...)> define(const std::string &, const std::string &,
+                                                             std::type_identity<Return(Params...)>);
+
+      public:
+        template <typename Signature>
+        [[sc::thread_safe]] [[nodiscard]] auto define(const std::string &name, const std::string &source);
+
+      public:
+        template <typename T, typename... Callables>
+        [[sc::thread_safe]] [[nodiscard]] object_handle share(std::shared_ptr<T> object, member<Callables>... members);
+
+      public:
+        template <typename T>
+        [[sc::thread_safe]] void publish(const std::string &channel, T &&value);
+
+      public:
+        template <typename... Params>
+        [[nodiscard]] static serialized_event make_event(const std::string &event, Params &&...params);
     };
 } // namespace saucer
 
@@ -2,8 +2,29 @@
 
 #include "smartview.hpp"
 
+#include <boost/callable_traits.hpp>
+
 namespace saucer
 {
+    namespace detail
+    {
+        template <typename T, typename Callable, typename Self, typename... Params>
+        auto bind(std::shared_ptr<T> object, Callable callable, std::type_identity<std::tuple<Self, Params...>>)
+        {
+            return [object = std::move(object), callable = std::move(callable)](Params... params)
+            {
+                return std::invoke(callable, *object, std::forward<Params>(params)...);
+            };
+        }
+
+        template <typename T, typename Callable>
+        auto bind(std::shared_ptr<T> object, Callable callable)
+        {
+            using args_t = boost::callable_traits::args_t<Callable>;
+            return bind(std::move(object), std::move(callable), std::type_identity<args_t>{});
+        }
+    } // namespace detail
+
     template <Serializer Serializer, Module... Modules>
     smartview<Serializer, Modules...>::smartview(const options &options)
         : smartview_core(std::make_unique<Serializer>(), options), Modules(this)...
@@ -14,25 +35,317 @@ namespace saucer
     }
 
     template <Serializer Serializer, Module... Modules>
-    template <typename Return, typename... Params>
-    std::future<Return> smartview<Serializer, Modules...>::evaluate(const std::string &code, Params &&...params)
+    template <typename Return>
+    std::future<Return> smartview<Serializer, Modules...>::evaluate_code(std::string code,
+                                                                        const evaluate_options &options)
     {
         auto promise = std::make_shared<std::promise<Return>>();
         auto rtn     = promise->get_future();
 
-        auto args    = Serializer::serialize_args(std::forward<Params>(params)...);
         auto resolve = Serializer::resolve(promise);
+        auto reject  = [promise](std::exception_ptr error)
+        {
+            promise->set_exception(std::move(error));
+        };
+
+        if constexpr (std::is_same_v<Return, js_handle>)
+        {
+            auto id = m_id_counter++;
+
+            add_handle(id);
+            code = fmt::format("window.saucer._handle({}, {})", id, code);
+        }
 
-        add_evaluation(std::move(resolve), fmt::vformat(code, args));
+        add_evaluation(std::move(resolve), std::move(reject), code, options);
 
         return rtn;
     }
 
+    template <Serializer Serializer, Module... Modules>
+    template <typename... Params>
+    bool smartview<Serializer, Modules...>::usable(const Params &...params) const
+    {
+        [[maybe_unused]] const auto check = [this]<typename T>(const auto &self, const T &param) -> bool
+        {
+            if constexpr (std::is_same_v<T, js_handle>)
+            {
+                return owns(param);
+            }
+            else if constexpr (is_arguments<T>)
+            {
+                return std::apply([&](const auto &...args) { return (self(self, args) && ...); },
+                                  static_cast<const typename T::underlying &>(param));
+            }
+            else
+            {
+                return true;
+            }
+        };
+
+        return (check(check, params) && ...);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return>
+    std::future<Return> smartview<Serializer, Modules...>::released()
+    {
+        std::promise<Return> promise;
+        promise.set_exception(std::make_exception_ptr(exceptions::released{}));
+
+        return promise.get_future();
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, typename... Params>
+    std::future<Return> smartview<Serializer, Modules...>::evaluate(const std::string &code, Params &&...params)
+    {
+        return evaluate<Return>(priority::normal, code, std::forward<Params>(params)...);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, typename... Params>
+    std::future<Return> smartview<Serializer, Modules...>::evaluate(priority priority, const std::string &code,
+                                                                   Params &&...params)
+    {
+        return evaluate<Return>(evaluate_options{.priority = priority}, code, std::forward<Params>(params)...);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, typename... Params>
+    std::future<Return> smartview<Serializer, Modules...>::evaluate(const evaluate_options &options,
+                                                                   const std::string &code, Params &&...params)
+    {
+        if (!usable(params...))
+        {
+            return released<Return>();
+        }
+
+        auto args = Serializer::serialize_args(std::forward<Params>(params)...);
+        return evaluate_code<Return>(fmt::vformat(code, args), options);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, format_string Code, typename... Params>
+        requires(!std::same_as<std::remove_cvref_t<Params>, evaluate_options> && ...)
+    std::future<Return> smartview<Serializer, Modules...>::evaluate(Params &&...params)
+    {
+        return evaluate<Return, Code>(evaluate_options{}, std::forward<Params>(params)...);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, format_string Code, typename... Params>
+    std::future<Return> smartview<Serializer, Modules...>::evaluate(const evaluate_options &options,
+                                                                   Params &&...params)
+    {
+        static constexpr auto format = Code.parse();
+        static_assert(format.count == sizeof...(Params), "The amount of placeholders must match the amount of arguments");
+
+        if (!usable(params...))
+        {
+            return released<Return>();
+        }
+
+        std::string code;
+        code.reserve(format.size + (sizeof...(Params) * 32));
+
+        auto last  = std::size_t{0};
+        auto index = std::size_t{0};
+
+        [[maybe_unused]] const auto append = [&](const auto &param)
+        {
+            code.append(format.text.data() + last, format.positions[index] - last);
+            last = format.positions[index++];
+
+            Serializer::serialize_arg(code, param, true);
+        };
+
+        (append(params), ...);
+        code.append(format.text.data() + last, format.size - last);
+
+        return evaluate_code<Return>(std::move(code), options);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, typename... Params>
+    std::future<Return> smartview<Serializer, Modules...>::call(const js_handle &target, const std::string &method,
+                                                                Params &&...params)
+    {
+        return call<Return>(evaluate_options{}, target, method, std::forward<Params>(params)...);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, typename... Params>
+    std::future<Return> smartview<Serializer, Modules...>::call(const evaluate_options &options,
+                                                                const js_handle &target, const std::string &method,
+                                                                Params &&...params)
+    {
+        if (!usable(target, params...))
+        {
+            return released<Return>();
+        }
+
+        //? The method is looked up on the object itself, so that it is called with the object as `this`.
+
+        std::string code;
+
+        Serializer::serialize_arg(code, target);
+        code += '[';
+
+        Serializer::serialize_arg(code, method);
+        code += "](";
+
+        auto first = true;
+
+        [[maybe_unused]] const auto append = [&](const auto &param)
+        {
+            if (!std::exchange(first, false))
+            {
+                code += ", ";
+            }
+
+            Serializer::serialize_arg(code, param);
+        };
+
+        (append(params), ...);
+        code += ')';
+
+        return evaluate_code<Return>(std::move(code), options);
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename... Params>
+    void smartview<Serializer, Modules...>::send_event(const std::string &event, Params &&...params)
+    {
+        send_event(make_event(event, std::forward<Params>(params)...));
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename... Params>
+    serialized_event smartview<Serializer, Modules...>::make_event(const std::string &event, Params &&...params)
+    {
+        std::string code{"window.saucer._emit("};
+        Serializer::serialize_arg(code, event);
+
+        code += ", [";
+
+        [[maybe_unused]] const auto append = [&](const auto &param)
+        {
+            Serializer::serialize_arg(code, param);
+            code += ", ";
+        };
+
+        (append(params), ...);
+        code += "]);";
+
+        return {std::move(code)};
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Return, typename... Params>
+    std::function<std::future<Return>(Params...)> smartview<Serializer, Modules...>::define(
+        const std::string &name, const std::string &source, std::type_identity<Return(Params...)>)
+    {
+        auto id = m_id_counter++;
+
+        std::string definition = fmt::format("window.saucer._define({}, ", id);
+        Serializer::serialize_arg(definition, name);
+
+        add_definition(fmt::format("{}, ({}));", definition, source));
+
+        return [this, prefix = fmt::format("window.saucer._functions[{}](", id)](Params... params)
+        {
+            if (!usable(params...))
+            {
+                return released<Return>();
+            }
+
+            auto code  = prefix;
+            auto first = true;
+
+            [[maybe_unused]] const auto append = [&](const auto &param)
+            {
+                if (!std::exchange(first, false))
+                {
+                    code += ", ";
+                }
+
+                Serializer::serialize_arg(code, param);
+            };
+
+            (append(params), ...);
+            code += ')';
+
+            return evaluate_code<Return>(std::move(code));
+        };
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Signature>
+    auto smartview<Serializer, Modules...>::define(const std::string &name, const std::string &source)
+    {
+        return define(name, source, std::type_identity<Signature>{});
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename T, typename... Callables>
+    object_handle smartview<Serializer, Modules...>::share(std::shared_ptr<T> object, member<Callables>... members)
+    {
+        std::map<std::string, serializer::function> functions;
+        (functions.emplace(std::move(members.name), Serializer::serialize(detail::bind(object, members.callable))), ...);
+
+        auto id = m_id_counter++;
+        add_object(id, std::move(object), std::move(functions));
+
+        return {id};
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename T>
+    void smartview<Serializer, Modules...>::publish(const std::string &channel, T &&value)
+    {
+        std::string entry{"["};
+
+        Serializer::serialize_arg(entry, channel);
+        entry += ", ";
+
+        Serializer::serialize_arg(entry, value);
+        entry += ']';
+
+        add_publication(channel, std::move(entry));
+    }
+
     template <Serializer Serializer, Module... Modules>
     template <typename Function>
-    void smartview<Serializer, Modules...>::expose(std::string name, const Function &func, bool async)
+    bool smartview<Serializer, Modules...>::expose(std::string name, const Function &func, policy policy,
+                                                   priority priority)
     {
+        using args_t = boost::callable_traits::args_t<Function>;
+
         auto resolve = Serializer::serialize(func);
-        add_function(std::move(name), std::move(resolve), async);
+        auto index   = add_function(name, std::move(resolve), policy, priority);
+
+        if (!index)
+        {
+            return false;
+        }
+
+        auto definition = fmt::format("window.saucer._expose({}, ", *index);
+        Serializer::serialize_arg(definition, name);
+
+        add_definition(fmt::format("{}, {});", definition, std::tuple_size_v<args_t>));
+
+        return true;
+    }
+
+    template <Serializer Serializer, Module... Modules>
+    template <typename Function>
+    bool smartview<Serializer, Modules...>::expose(std::string name, const Function &func, bool async)
+    {
+        if (!async)
+        {
+            return expose(std::move(name), func, policies::ui{});
+        }
+
+        return expose(std::move(name), func, policies::pool{});
     }
 } // namespace saucer
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace saucer
+{
+    enum class startup_phase : std::uint8_t
+    {
+        application,
+        window,
+        engine,
+        bridge,
+        dom_ready,
+        first_call,
+    };
+
+    //? Every phase is the time from the start of the window construction until the phase was reached, phases that were
+    //? not reached yet are unset. `dom_ready` is the first time the DOM of a page was ready, which is the closest the
+    //? engines let us get to the first painted frame. `first_call` is the first call from JavaScript that succeeded.
+
+    struct startup_timings
+    {
+        using duration = std::chrono::nanoseconds;
+
+      public:
+        std::optional<duration> application;
+        std::optional<duration> window;
+        std::optional<duration> engine;
+        std::optional<duration> bridge;
+
+      public:
+        std::optional<duration> dom_ready;
+        std::optional<duration> first_call;
+    };
+} // namespace saucer
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <span>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace saucer
+{
+    enum class embedded_encoding : std::uint8_t
+    {
+        identity,
+        brotli,
+    };
+
+    struct embedded_entry
+    {
+        std::string_view path;
+        std::string_view mime;
+        std::span<const std::uint8_t> content;
+
+      public:
+        //? Compressed entries are decoded on first request, `size` is their decoded size.
+        embedded_encoding encoding{embedded_encoding::identity};
+        std::size_t size{0};
+    };
+
+    //? A non-owning view over a perfect-hash table of embedded files. Looking up a path costs one hash and at most one
+    //? string comparison. The referenced storage has to outlive the view, which is why tables are usually created as
+    //? `static constexpr` variables through `make_embedded_table`.
+
+    class embedded_table
+    {
+        std::span<const embedded_entry> m_entries;
+
+      private:
+        std::span<const std::uint32_t> m_seeds;
+        std::span<const std::uint32_t> m_slots;
+
+      public:
+        constexpr embedded_table() = default;
+        constexpr embedded_table(std::span<const embedded_entry> entries, std::span<const std::uint32_t> seeds,
+                                 std::span<const std::uint32_t> slots);
+
+      public:
+        [[nodiscard]] constexpr const embedded_entry *find(std::string_view path) const;
+
+      public:
+        [[nodiscard]] constexpr std::size_t size() const;
+        [[nodiscard]] constexpr auto begin() const;
+        [[nodiscard]] constexpr auto end() const;
+    };
+
+    namespace detail::embedded
+    {
+        inline constexpr auto empty = ~std::uint32_t{0};
+
+        constexpr std::uint64_t hash(std::string_view);
+        constexpr std::string_view mime(std::string_view path);
+        constexpr std::size_t bucket(std::uint64_t hash, std::size_t buckets);
+        constexpr std::size_t slot(std::uint64_t hash, std::uint32_t seed, std::size_t slots);
+
+        constexpr std::size_t bucket_count(std::size_t entries);
+        constexpr std::size_t slot_count(std::size_t entries);
+
+        constexpr void build(std::span<const embedded_entry> entries, std::span<std::uint32_t> seeds,
+                             std::span<std::uint32_t> slots);
+    } // namespace detail::embedded
+
+    template <std::size_t N>
+    struct static_embedded_table
+    {
+        std::array<embedded_entry, N> entries;
+
+      public:
+        std::array<std::uint32_t, detail::embedded::bucket_count(N)> seeds;
+        std::array<std::uint32_t, detail::embedded::slot_count(N)> slots;
+
+      public:
+        constexpr operator embedded_table() const;
+    };
+
+    //? Builds the table at compile time when used to initialize a `constexpr` variable. Duplicate paths are rejected,
+    //? which turns into a compile error in that case.
+
+    template <std::size_t N>
+    constexpr static_embedded_table<N> make_embedded_table(const std::array<embedded_entry, N> &entries);
+} // namespace saucer
+
+#include "embedded.inl"
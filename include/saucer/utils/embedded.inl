@@ -0,0 +1,282 @@
+#pragma once
+
+#include "embedded.hpp"
+
+#include <bit>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+namespace saucer
+{
+    namespace detail::embedded
+    {
+        constexpr std::uint64_t hash(std::string_view value)
+        {
+            std::uint64_t rtn = 0xcbf29ce484222325;
+
+            for (const auto &c : value)
+            {
+                rtn ^= static_cast<std::uint8_t>(c);
+                rtn *= 0x100000001b3;
+            }
+
+            //? FNV-1a alone leaves the upper bits poorly mixed for short, similar paths, so we finalize it like
+            //? splitmix does. The bucket is taken from the upper half of the result, the slot from a remix of all of it.
+
+            rtn ^= rtn >> 30;
+            rtn *= 0xbf58476d1ce4e5b9;
+            rtn ^= rtn >> 27;
+            rtn *= 0x94d049bb133111eb;
+            rtn ^= rtn >> 31;
+
+            return rtn;
+        }
+
+        constexpr std::size_t bucket(std::uint64_t hash, std::size_t buckets)
+        {
+            return static_cast<std::size_t>(hash >> 32) & (buckets - 1);
+        }
+
+        constexpr std::size_t slot(std::uint64_t hash, std::uint32_t seed, std::size_t slots)
+        {
+            //? Every seed yields an independent placement for the members of a bucket, which keeps members that share
+            //? some bits of their hash from always colliding with each other.
+
+            hash ^= seed * 0x9e3779b97f4a7c15;
+            hash *= 0xff51afd7ed558ccd;
+            hash ^= hash >> 32;
+
+            return static_cast<std::size_t>(hash) & (slots - 1);
+        }
+
+        constexpr std::string_view mime(std::string_view path)
+        {
+            constexpr std::pair<std::string_view, std::string_view> types[] = {
+                {".html", "text/html"},
+                {".htm", "text/html"},
+                {".css", "text/css"},
+                {".js", "text/javascript"},
+                {".mjs", "text/javascript"},
+                {".json", "application/json"},
+                {".map", "application/json"},
+                {".wasm", "application/wasm"},
+                {".xml", "application/xml"},
+                {".txt", "text/plain"},
+                {".csv", "text/csv"},
+                {".md", "text/markdown"},
+                {".svg", "image/svg+xml"},
+                {".png", "image/png"},
+                {".jpg", "image/jpeg"},
+                {".jpeg", "image/jpeg"},
+                {".gif", "image/gif"},
+                {".webp", "image/webp"},
+                {".avif", "image/avif"},
+                {".ico", "image/x-icon"},
+                {".bmp", "image/bmp"},
+                {".woff", "font/woff"},
+                {".woff2", "font/woff2"},
+                {".ttf", "font/ttf"},
+                {".otf", "font/otf"},
+                {".mp3", "audio/mpeg"},
+                {".ogg", "audio/ogg"},
+                {".wav", "audio/wav"},
+                {".flac", "audio/flac"},
+                {".m4a", "audio/mp4"},
+                {".mp4", "video/mp4"},
+                {".webm", "video/webm"},
+                {".mov", "video/quicktime"},
+                {".pdf", "application/pdf"},
+                {".zip", "application/zip"},
+            };
+
+            const auto dot = path.find_last_of("./");
+
+            if (dot == std::string_view::npos || path[dot] != '.')
+            {
+                return "application/octet-stream";
+            }
+
+            const auto extension = path.substr(dot);
+
+            auto equal = [](std::string_view lhs, std::string_view rhs)
+            {
+                return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                  [](char a, char b) { return (a >= 'A' && a <= 'Z' ? a + ('a' - 'A') : a) == b; });
+            };
+
+            for (const auto &[ext, type] : types)
+            {
+                if (equal(extension, ext))
+                {
+                    return type;
+                }
+            }
+
+            return "application/octet-stream";
+        }
+
+        constexpr std::size_t bucket_count(std::size_t entries)
+        {
+            return std::bit_ceil(std::max<std::size_t>(entries / 2, 1));
+        }
+
+        constexpr std::size_t slot_count(std::size_t entries)
+        {
+            return std::bit_ceil(std::max<std::size_t>(entries + (entries / 4), 1));
+        }
+
+        constexpr void build(std::span<const embedded_entry> entries, std::span<std::uint32_t> seeds,
+                             std::span<std::uint32_t> slots)
+        {
+            std::fill(slots.begin(), slots.end(), empty);
+            std::fill(seeds.begin(), seeds.end(), 0);
+
+            std::vector<std::uint64_t> hashes(entries.size());
+            std::vector<std::size_t> members(entries.size());
+
+            std::vector<std::size_t> offsets(seeds.size() + 1);
+            std::vector<std::size_t> order(seeds.size());
+
+            for (auto i = 0u; entries.size() > i; i++)
+            {
+                hashes[i] = hash(entries[i].path);
+                offsets[bucket(hashes[i], seeds.size()) + 1]++;
+            }
+
+            for (auto i = 0u; seeds.size() > i; i++)
+            {
+                offsets[i + 1] += offsets[i];
+                order[i] = i;
+            }
+
+            auto fill = offsets;
+
+            for (auto i = 0u; entries.size() > i; i++)
+            {
+                members[fill[bucket(hashes[i], seeds.size())]++] = i;
+            }
+
+            //? Buckets with the most members are placed first, while most of the slots are still free.
+
+            auto size = [&](std::size_t bucket)
+            {
+                return offsets[bucket + 1] - offsets[bucket];
+            };
+
+            std::sort(order.begin(), order.end(), [&](auto a, auto b) { return size(a) > size(b); });
+
+            for (const auto &current : order)
+            {
+                const auto begin = offsets[current];
+                const auto end   = offsets[current + 1];
+
+                for (auto i = begin; end > i; i++)
+                {
+                    for (auto j = i + 1; end > j; j++)
+                    {
+                        if (entries[members[i]].path == entries[members[j]].path)
+                        {
+                            throw std::invalid_argument("Duplicate path in embedded table");
+                        }
+                    }
+                }
+
+                bool placed = begin == end;
+
+                for (std::uint32_t seed = 0; !placed && slots.size() * 4 > seed; seed++)
+                {
+                    auto i = begin;
+
+                    for (; end > i; i++)
+                    {
+                        auto &target = slots[slot(hashes[members[i]], seed, slots.size())];
+
+                        if (target != empty)
+                        {
+                            break;
+                        }
+
+                        target = static_cast<std::uint32_t>(members[i]);
+                    }
+
+                    if (i == end)
+                    {
+                        seeds[current] = seed;
+                        placed         = true;
+                        continue;
+                    }
+
+                    for (auto j = begin; i > j; j++)
+                    {
+                        slots[slot(hashes[members[j]], seed, slots.size())] = empty;
+                    }
+                }
+
+                if (!placed)
+                {
+                    throw std::invalid_argument("Failed to build perfect hash for embedded table");
+                }
+            }
+        }
+    } // namespace detail::embedded
+
+    constexpr embedded_table::embedded_table(std::span<const embedded_entry> entries,
+                                             std::span<const std::uint32_t> seeds,
+                                             std::span<const std::uint32_t> slots)
+        : m_entries(entries), m_seeds(seeds), m_slots(slots)
+    {
+    }
+
+    constexpr const embedded_entry *embedded_table::find(std::string_view path) const
+    {
+        using namespace detail::embedded;
+
+        if (m_entries.empty())
+        {
+            return nullptr;
+        }
+
+        const auto hashed = hash(path);
+        const auto seed   = m_seeds[bucket(hashed, m_seeds.size())];
+        const auto index  = m_slots[slot(hashed, seed, m_slots.size())];
+
+        if (index == empty || m_entries[index].path != path)
+        {
+            return nullptr;
+        }
+
+        return &m_entries[index];
+    }
+
+    constexpr std::size_t embedded_table::size() const
+    {
+        return m_entries.size();
+    }
+
+    constexpr auto embedded_table::begin() const
+    {
+        return m_entries.begin();
+    }
+
+    constexpr auto embedded_table::end() const
+    {
+        return m_entries.end();
+    }
+
+    template <std::size_t N>
+    constexpr static_embedded_table<N>::operator embedded_table() const
+    {
+        return {entries, seeds, slots};
+    }
+
+    template <std::size_t N>
+    constexpr static_embedded_table<N> make_embedded_table(const std::array<embedded_entry, N> &entries)
+    {
+        static_embedded_table<N> rtn{entries, {}, {}};
+        detail::embedded::build(rtn.entries, rtn.seeds, rtn.slots);
+
+        return rtn;
+    }
+} // namespace saucer
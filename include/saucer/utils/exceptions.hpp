@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace saucer::exceptions
+{
+    //? Thrown by evaluation futures whose document was replaced before it answered.
+
+    class navigation : public std::runtime_error
+    {
+      public:
+        navigation();
+    };
+
+    //? Thrown by evaluation futures that were not answered before their deadline.
+
+    class timeout : public std::runtime_error
+    {
+      public:
+        timeout();
+    };
+
+    //? Thrown by evaluation futures that use a js_handle which was released or belongs to a replaced document.
+
+    class released : public std::runtime_error
+    {
+      public:
+        released();
+    };
+
+    //? Thrown by evaluation futures that were still pending, or created, while the smartview shut down.
+
+    class closed : public std::runtime_error
+    {
+      public:
+        closed();
+    };
+} // namespace saucer::exceptions
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace saucer
+{
+    template <std::size_t N>
+    struct parsed_format
+    {
+        std::size_t size{0};
+        std::array<char, N> text{};
+
+      public:
+        std::size_t count{0};
+        std::array<std::size_t, N> positions{};
+    };
+
+    template <std::size_t N>
+    struct format_string
+    {
+        std::array<char, N> value{};
+
+      public:
+        consteval format_string(const char (&str)[N]);
+
+      public:
+        [[nodiscard]] constexpr parsed_format<N> parse() const;
+    };
+} // namespace saucer
+
+#include "format.inl"
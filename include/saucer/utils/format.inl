@@ -0,0 +1,50 @@
+#pragma once
+
+#include "format.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace saucer
+{
+    template <std::size_t N>
+    consteval format_string<N>::format_string(const char (&str)[N])
+    {
+        std::copy_n(str, N, value.begin());
+    }
+
+    template <std::size_t N>
+    constexpr parsed_format<N> format_string<N>::parse() const
+    {
+        parsed_format<N> rtn{};
+
+        for (auto i = 0u; N - 1 > i; i++)
+        {
+            const auto current = value[i];
+            const auto next    = value[i + 1];
+
+            if (current == '{' && next == '}')
+            {
+                rtn.positions[rtn.count++] = rtn.size;
+                i++;
+                continue;
+            }
+
+            if ((current == '{' && next == '{') || (current == '}' && next == '}'))
+            {
+                rtn.text[rtn.size++] = current;
+                i++;
+                continue;
+            }
+
+            if (current == '{' || current == '}')
+            {
+                throw std::invalid_argument("Bad format string, only empty placeholders are supported");
+            }
+
+            rtn.text[rtn.size++] = current;
+        }
+
+        return rtn;
+    }
+} // namespace saucer
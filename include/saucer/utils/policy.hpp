@@ -0,0 +1,80 @@
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <variant>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+
+namespace saucer
+{
+    namespace policies
+    {
+        //? Runs the function on the UI thread, in the order the calls arrive.
+        struct ui
+        {
+        };
+
+        //? Runs the function on the shared thread pool.
+        struct pool
+        {
+        };
+
+        //? Runs the function on the pool, one call at a time. Functions that name the same queue share it.
+        struct serial
+        {
+            std::string queue;
+        };
+
+        //? Runs the function on the pool with at most `concurrency` calls in flight, excess calls wait in order.
+        struct limited
+        {
+            std::size_t concurrency;
+        };
+    } // namespace policies
+
+    using policy = std::variant<policies::ui, policies::pool, policies::serial, policies::limited>;
+
+    enum class priority : std::uint8_t
+    {
+        low,
+        normal,
+        high,
+    };
+
+    struct limits
+    {
+        //? Maximum amount of calls that are being executed at the same time.
+        std::optional<std::size_t> in_flight{};
+
+        //? Maximum amount of calls that are admitted per second, bursts of up to this size are allowed.
+        std::optional<std::size_t> per_second{};
+
+        //? Calls that exceed `in_flight` or `per_second` are queued in order until this many are waiting, after which
+        //? they are rejected.
+        //? Only used for functions that do not run on the UI thread, calls that exceed the global limits are always
+        //? rejected.
+        std::size_t backlog{0};
+    };
+
+    struct admission_stats
+    {
+        std::uint64_t admitted;
+        std::uint64_t queued;
+        std::uint64_t rejected;
+    };
+
+    struct execution_stats
+    {
+        std::size_t queued;
+        std::size_t running;
+
+      public:
+        std::uint64_t completed;
+
+      public:
+        std::chrono::nanoseconds total_wait;
+        std::chrono::nanoseconds max_wait;
+    };
+} // namespace saucer
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../smartview.hpp"
+#include "../serializers/glaze/glaze.hpp"
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <shared_mutex>
+
+#include <lockpp/lock.hpp>
+
+namespace saucer
+{
+    namespace detail::state
+    {
+        void diff(const glz::json_t &from, const glz::json_t &to, const std::string &path, std::vector<std::string> &);
+
+        [[nodiscard]] bool apply(glz::json_t &document, const std::string &patch);
+        [[nodiscard]] std::string script(const std::string &name, std::uint64_t version, const std::vector<std::string> &);
+    } // namespace detail::state
+
+    template <typename T>
+    class shared_state
+    {
+        struct impl;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        //? The state may outlive the smartview, changes made after the smartview was destroyed only update the value.
+        //? Once the state is destroyed its name may be used again.
+
+        template <Module... Modules>
+        shared_state(smartview<serializers::glaze, Modules...> &smartview, std::string name, T value = {});
+
+      public:
+        shared_state(const shared_state &) = delete;
+        shared_state &operator=(const shared_state &) = delete;
+
+      public:
+        ~shared_state();
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] T value() const;
+        [[sc::thread_safe]] [[nodiscard]] std::uint64_t version() const;
+
+      public:
+        [[sc::thread_safe]] void set(T value);
+
+        template <typename Callback>
+        [[sc::thread_safe]] void modify(Callback &&callback);
+
+      public:
+        [[sc::thread_safe]] void on_change(std::function<void(const T &)> callback);
+    };
+} // namespace saucer
+
+#include "shared_state.inl"
@@ -0,0 +1,311 @@
+#pragma once
+
+#include "shared_state.hpp"
+
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+
+#include <fmt/core.h>
+
+namespace saucer
+{
+    namespace detail::state
+    {
+        inline constexpr auto opts = serializers::detail::glaze::opts;
+    } // namespace detail::state
+
+    template <typename T>
+    struct shared_state<T>::impl : std::enable_shared_from_this<impl>
+    {
+        struct state_data
+        {
+            T value;
+            glz::json_t json;
+            std::uint64_t version{0};
+            std::function<void(const T &)> on_change;
+
+          public:
+            //? The serialized form of `json`, the new value is written into `buffer` and only parsed and compared to
+            //? `json` when it differs. The buffers are swapped afterwards, so that neither is allocated again.
+            std::string serialized;
+            std::string buffer;
+        };
+
+      public:
+        std::string name;
+
+      public:
+        //? Cleared once either side is gone. Scripts are only dispatched while holding the lifetime, which never blocks,
+        //? so that a destroyed smartview does not wait on a sender that in turn waits for its UI thread.
+        std::shared_mutex lifetime;
+        smartview_core *parent;
+        std::uint64_t attachment;
+
+      public:
+        lockpp::lock<state_data> state;
+
+      public:
+        void send(std::string script);
+        std::string commit(state_data &);
+        std::optional<std::uint64_t> receive(std::uint64_t base, const std::string &patch);
+    };
+
+    template <typename T>
+    void shared_state<T>::impl::send(std::string script)
+    {
+        std::shared_lock guard{lifetime};
+
+        if (!parent)
+        {
+            return;
+        }
+
+        //? The smartview may be destroyed before the script runs, the lifetime tells whether it is still around.
+
+        parent->dispatch(
+            [self = this->shared_from_this(), script = std::move(script)]() mutable
+            {
+                std::shared_lock guard{self->lifetime};
+
+                if (!self->parent)
+                {
+                    return;
+                }
+
+                self->parent->send_event({std::move(script)});
+            });
+    }
+
+    template <typename T>
+    std::string shared_state<T>::impl::commit(state_data &data)
+    {
+        if (glz::write<detail::state::opts>(data.value, data.buffer) || data.buffer == data.serialized)
+        {
+            return {};
+        }
+
+        glz::json_t json{};
+
+        if (glz::read<detail::state::opts>(json, data.buffer))
+        {
+            return {};
+        }
+
+        std::vector<std::string> operations;
+        detail::state::diff(data.json, json, "", operations);
+
+        data.json = std::move(json);
+        data.serialized.swap(data.buffer);
+
+        if (operations.empty())
+        {
+            return {};
+        }
+
+        data.version++;
+
+        return detail::state::script(name, data.version, operations);
+    }
+
+    template <typename T>
+    std::optional<std::uint64_t> shared_state<T>::impl::receive(std::uint64_t base, const std::string &patch)
+    {
+        std::string script;
+        std::uint64_t version{};
+
+        std::optional<T> changed;
+        std::function<void(const T &)> callback;
+
+        {
+            auto locked = state.write();
+
+            if (base != locked->version)
+            {
+                return std::nullopt;
+            }
+
+            auto json = locked->json;
+
+            if (!detail::state::apply(json, patch))
+            {
+                return std::nullopt;
+            }
+
+            auto serialized = glz::write<detail::state::opts>(json);
+            T value{};
+
+            if (!serialized || glz::read<detail::state::opts>(value, serialized.value()))
+            {
+                return std::nullopt;
+            }
+
+            locked->value = std::move(value);
+            locked->json  = std::move(json);
+
+            //? The serialized form no longer matches the patched document, the commit below has to compare them.
+            locked->serialized.clear();
+
+            locked->version++;
+
+            //? The page may have sent values that differ from their canonical representation (i.e. unknown keys), in
+            //? which case we follow up with a patch that corrects its copy. The page has to learn the version of that
+            //? patch, otherwise it would apply it on top of a version it already considers current.
+
+            script   = commit(*locked);
+            version  = locked->version;
+            changed  = locked->value;
+            callback = locked->on_change;
+        }
+
+        if (!script.empty())
+        {
+            send(std::move(script));
+        }
+
+        if (callback)
+        {
+            callback(*changed);
+        }
+
+        return version;
+    }
+
+    template <typename T>
+    template <Module... Modules>
+    shared_state<T>::shared_state(smartview<serializers::glaze, Modules...> &smartview, std::string name, T value)
+        : m_impl(std::make_shared<impl>())
+    {
+        m_impl->name   = std::move(name);
+        m_impl->parent = &smartview;
+
+        {
+            auto locked   = m_impl->state.write();
+            locked->value = std::move(value);
+
+            m_impl->commit(*locked);
+        }
+
+        auto receive = [impl = m_impl](std::uint64_t base, const std::string &patch)
+        {
+            return impl->receive(base, patch);
+        };
+
+        auto snapshot = [impl = m_impl]
+        {
+            auto locked = impl->state.read();
+
+            glz::raw_json json{};
+            json.str = locked->serialized.empty() ? "null" : locked->serialized;
+
+            return std::make_tuple(locked->version, std::move(json));
+        };
+
+        if (!smartview.expose(fmt::format("saucer:state:patch:{}", m_impl->name), receive))
+        {
+            throw std::invalid_argument(fmt::format("Duplicate shared state \"{}\"", m_impl->name));
+        }
+
+        smartview.expose(fmt::format("saucer:state:get:{}", m_impl->name), snapshot);
+
+        m_impl->attachment = smartview.attach(
+            [impl = m_impl]
+            {
+                std::unique_lock guard{impl->lifetime};
+                impl->parent = nullptr;
+            });
+    }
+
+    template <typename T>
+    shared_state<T>::~shared_state()
+    {
+        std::shared_lock guard{m_impl->lifetime};
+
+        if (!m_impl->parent)
+        {
+            return;
+        }
+
+        m_impl->parent->unexpose(fmt::format("saucer:state:patch:{}", m_impl->name));
+        m_impl->parent->unexpose(fmt::format("saucer:state:get:{}", m_impl->name));
+
+        //? The page forgets its copy, so that a state created under the same name later on starts from scratch. Only
+        //? then the smartview lets go of the state, scripts that are still queued after it are dropped.
+
+        auto name   = glz::write<detail::state::opts>(m_impl->name).value_or("\"\"");
+        auto script = fmt::format("window.saucer._states.delete({});", name);
+
+        m_impl->parent->dispatch(
+            [self = m_impl, script = std::move(script)]() mutable
+            {
+                std::unique_lock guard{self->lifetime};
+
+                if (!self->parent)
+                {
+                    return;
+                }
+
+                self->parent->send_event({std::move(script)});
+                self->parent->detach(self->attachment);
+                self->parent = nullptr;
+            });
+    }
+
+    template <typename T>
+    T shared_state<T>::value() const
+    {
+        return m_impl->state.read()->value;
+    }
+
+    template <typename T>
+    std::uint64_t shared_state<T>::version() const
+    {
+        return m_impl->state.read()->version;
+    }
+
+    template <typename T>
+    void shared_state<T>::set(T value)
+    {
+        modify([&value](T &current) { current = std::move(value); });
+    }
+
+    template <typename T>
+    template <typename Callback>
+    void shared_state<T>::modify(Callback &&callback)
+    {
+        std::string script;
+
+        std::optional<T> changed;
+        std::function<void(const T &)> on_change;
+
+        {
+            auto locked = m_impl->state.write();
+            std::invoke(std::forward<Callback>(callback), locked->value);
+
+            script = m_impl->commit(*locked);
+
+            if (!script.empty() && locked->on_change)
+            {
+                changed   = locked->value;
+                on_change = locked->on_change;
+            }
+        }
+
+        if (!script.empty())
+        {
+            m_impl->send(std::move(script));
+        }
+
+        if (on_change)
+        {
+            on_change(*changed);
+        }
+    }
+
+    template <typename T>
+    void shared_state<T>::on_change(std::function<void(const T &)> callback)
+    {
+        auto locked       = m_impl->state.write();
+        locked->on_change = std::move(callback);
+    }
+} // namespace saucer
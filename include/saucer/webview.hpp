@@ -1,11 +1,18 @@
 #pragma once
 
 #include "window.hpp"
+#include "scheme.hpp"
+#include "startup.hpp"
+#include "utils/embedded.hpp"
 
 #include <map>
 #include <span>
+#include <chrono>
 #include <string>
+#include <vector>
 #include <memory>
+#include <optional>
+#include <functional>
 
 #include <ereignis/manager.hpp>
 
@@ -25,6 +32,16 @@ namespace saucer
         dom_ready,
     };
 
+    struct pending_stats
+    {
+        std::size_t scripts;
+        std::size_t bytes;
+
+      public:
+        //? Scripts that were dropped because the queue was full.
+        std::uint64_t dropped;
+    };
+
     struct embedded_file
     {
         std::string mime;
@@ -37,6 +54,8 @@ namespace saucer
 
       private:
         using embedded_files = std::map<std::string, embedded_file>;
+        using embedded_store = std::map<std::string, embedded_file, std::less<>>;
+        using handler_store  = std::map<std::string, std::shared_ptr<response_handler>, std::less<>>;
 
       private:
         using events = ereignis::manager<                                       //
@@ -48,7 +67,15 @@ namespace saucer
 
       private:
         events m_events;
-        embedded_files m_embedded_files;
+        embedded_store m_embedded_files;
+        std::vector<embedded_table> m_embedded_tables;
+
+      private:
+        handler_store m_handlers;
+
+      private:
+        [[nodiscard]] std::optional<embedded_entry> find_embedded(std::string_view path) const;
+        [[nodiscard]] std::shared_ptr<response_handler> find_handler(std::string_view path) const;
 
       protected:
         std::unique_ptr<impl> m_impl;
@@ -56,6 +83,13 @@ namespace saucer
       protected:
         virtual bool on_message(const std::string &);
 
+      protected:
+        [[sc::thread_safe]] void record(startup_phase phase);
+
+      protected:
+        //? Like `execute`, but the script is never dropped from the pending queue. Used for the scripts of the bridge.
+        [[sc::thread_safe]] void execute_internal(const std::string &java_script);
+
       public:
         webview(const options & = {});
 
@@ -74,7 +108,20 @@ namespace saucer
 
       public:
         [[sc::thread_safe]] void embed(embedded_files &&files);
+        [[sc::thread_safe]] void embed(embedded_table table);
+        [[sc::thread_safe]] void set_embedded_cache(std::size_t limit);
         [[sc::thread_safe]] void serve(const std::string &file);
+        [[sc::thread_safe]] void serve_directory(const std::filesystem::path &directory);
+        [[sc::thread_safe]] void serve_directory(const std::filesystem::path &directory, std::size_t budget);
+
+      public:
+        [[sc::thread_safe]] void remove_handler(const std::string &prefix);
+        [[sc::thread_safe]] void handle(const std::string &prefix, response_handler handler);
+
+        //? On destruction the webview waits at most `timeout` for response handlers that are still running, the amount
+        //? of handlers that did not finish in time is passed to `on_abandon`.
+        [[sc::thread_safe]] void set_handler_timeout(std::chrono::milliseconds timeout,
+                                                     std::function<void(std::size_t)> on_abandon = {});
 
       public:
         [[sc::thread_safe]] void clear_scripts();
@@ -82,6 +129,15 @@ namespace saucer
         [[sc::thread_safe]] void execute(const std::string &java_script);
         [[sc::thread_safe]] void inject(const std::string &java_script, const load_time &load_time);
 
+      public:
+        [[sc::thread_safe]] [[nodiscard]] startup_timings startup() const;
+
+      public:
+        //? Scripts executed before the DOM is ready are queued and run in order once it is, at most `limit` of them
+        //? are kept. Scripts queued internally (i.e. by the smartview) do not count towards the limit.
+        [[sc::thread_safe]] [[nodiscard]] pending_stats pending() const;
+        [[sc::thread_safe]] void set_pending_limit(std::size_t limit);
+
       public:
         using window::clear;
         [[sc::thread_safe]] void clear(web_event event);
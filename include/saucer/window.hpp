@@ -6,6 +6,7 @@
 #include <array>
 #include <vector>
 #include <utility>
+#include <functional>
 
 #include <cstdint>
 #include <filesystem>
@@ -93,6 +94,11 @@ namespace saucer
       public:
         [[sc::thread_safe]] void focus();
 
+      public:
+        //? Runs the callback on the UI thread without waiting for it. The callback is dropped if the window is destroyed
+        //? before it got to run.
+        [[sc::thread_safe]] void dispatch(std::function<void()> callback);
+
       public:
         [[sc::thread_safe]] void start_drag();
         [[sc::thread_safe]] void start_resize(window_edge edge);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "utils/embedded.hpp"
+
+#include <list>
+#include <span>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+namespace saucer
+{
+    struct asset
+    {
+        std::span<const std::uint8_t> content;
+
+      public:
+        //? Keeps decoded content alive while it is being served, even if it is evicted from the cache meanwhile.
+        std::shared_ptr<const void> owner;
+    };
+
+    //? Decodes compressed embedded files on demand and keeps the most recently used ones, up to `limit` decoded bytes.
+    //? Files that are not compressed are served in place and never take up space in the cache.
+
+    class asset_cache
+    {
+        using buffer = std::vector<std::uint8_t>;
+        using entry  = std::pair<const std::uint8_t *, std::shared_ptr<const buffer>>;
+
+      private:
+        std::mutex m_mutex;
+
+      private:
+        std::size_t m_size{0};
+        std::size_t m_limit;
+
+      private:
+        std::list<entry> m_entries;
+        std::unordered_map<const std::uint8_t *, std::list<entry>::iterator> m_index;
+
+      private:
+        void evict();
+        static std::shared_ptr<const buffer> decode(const embedded_entry &);
+
+      public:
+        static constexpr std::size_t default_limit = 32 * 1024 * 1024;
+
+      public:
+        asset_cache(std::size_t limit = default_limit);
+
+      public:
+        [[sc::thread_safe]] std::optional<asset> load(const embedded_entry &);
+
+      public:
+        [[sc::thread_safe]] void clear();
+        [[sc::thread_safe]] void set_limit(std::size_t);
+        [[sc::thread_safe]] [[nodiscard]] std::size_t size();
+    };
+} // namespace saucer
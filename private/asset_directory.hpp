@@ -0,0 +1,100 @@
+#pragma once
+
+#include "asset_cache.hpp"
+#include "mapped_file.hpp"
+
+#include <list>
+#include <mutex>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <filesystem>
+#include <string_view>
+#include <unordered_map>
+
+namespace saucer
+{
+    struct directory_file
+    {
+        std::filesystem::path path;
+        std::string_view mime;
+        std::size_t size;
+
+      public:
+        std::filesystem::file_time_type modified;
+    };
+
+    //? Serves the files of a directory from disk. The directory is indexed on construction, and files are looked up in
+    //? the index. A miss checks the requested file on disk and adds it to the index when it lies inside of the root,
+    //? so files created later are served as well. Every hit is stat'ed: a file that is gone is dropped from the index,
+    //? and a file whose size or modification time changed is re-read. Symlinks that lead outside of the directory are
+    //? never served.
+    //? Files of up to `read_limit` bytes are read into memory, larger ones are memory mapped. Loaded files are kept
+    //? until their total size exceeds `budget`, files that are larger than the budget on their own are only kept for as
+    //? long as they are being served.
+    //? Large files must be replaced (i.e. written to a new file and renamed over the old one) rather than truncated in
+    //? place while they are being served, as reading a truncated mapping raises SIGBUS.
+
+    class asset_directory
+    {
+        struct hash
+        {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view) const;
+        };
+
+        struct loaded
+        {
+            std::string key;
+            directory_file file;
+
+          public:
+            asset content;
+        };
+
+      private:
+        using index = std::unordered_map<std::string, directory_file, hash, std::equal_to<>>;
+
+      private:
+        std::filesystem::path m_root;
+
+      private:
+        std::mutex m_mutex;
+        index m_index;
+
+      private:
+        std::size_t m_budget;
+        std::size_t m_resident{0};
+
+      private:
+        std::list<loaded> m_loaded;
+        std::unordered_map<std::string, std::list<loaded>::iterator, hash, std::equal_to<>> m_lookup;
+
+      private:
+        std::optional<directory_file> lookup(const std::string &path);
+        std::optional<directory_file> discover(const std::string &path);
+
+      private:
+        void evict(std::list<loaded>::iterator);
+
+      public:
+        static constexpr std::size_t default_budget = 64 * 1024 * 1024;
+        static constexpr std::size_t read_limit     = 256 * 1024;
+
+      public:
+        asset_directory(const std::filesystem::path &root, std::size_t budget = default_budget);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::optional<directory_file> find(std::string_view path);
+
+      public:
+        using directories = std::vector<std::shared_ptr<asset_directory>>;
+        [[nodiscard]] static std::tuple<asset_directory *, std::optional<directory_file>> find(const directories &,
+                                                                                               std::string_view path);
+
+      public:
+        [[sc::thread_safe]] std::optional<asset> load(const directory_file &);
+    };
+} // namespace saucer
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace saucer
+{
+    struct byte_range
+    {
+        std::size_t first;
+        std::size_t last;
+    };
+
+    enum class range_result : std::uint8_t
+    {
+        full,
+        partial,
+        unsatisfiable,
+    };
+
+    //? Parses a single range of a "Range" header (`bytes=a-b`, `bytes=a-`, `bytes=-n`) for a file of `size` bytes. The
+    //? returned range is clamped to `max_length` bytes, which is allowed as the response states the range it contains.
+    //? Headers that are missing, malformed, invalid (i.e. `bytes=5-3`) or request multiple ranges result in the full file
+    //? being served.
+
+    std::pair<range_result, byte_range> parse_range(std::string_view header, std::size_t size, std::size_t max_length);
+} // namespace saucer
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "utils/policy.hpp"
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <condition_variable>
+
+#include <lockpp/lock.hpp>
+
+namespace saucer
+{
+    class executor
+    {
+        using task = std::function<void()>;
+
+      public:
+        template <typename T>
+        using lanes = std::array<std::deque<T>, 3>;
+
+      public:
+        class strand;
+
+      private:
+        struct queue
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+
+          public:
+            bool stop{false};
+            lanes<task> tasks;
+
+          public:
+            std::size_t active{0};
+            std::condition_variable idle;
+        };
+
+      private:
+        //? Shared with the workers, so that a worker whose task ends up destroying the executor can still exit safely.
+        std::shared_ptr<queue> m_queue;
+        std::vector<std::thread> m_workers;
+
+      public:
+        executor(std::size_t threads);
+
+      public:
+        ~executor();
+
+      public:
+        //? Drops the tasks that did not start yet and waits at most `timeout` for the running ones, calling `pump` in
+        //? between waits. Workers that are still busy afterwards are detached, the number of them is returned.
+        std::size_t shutdown(std::chrono::milliseconds timeout, const std::function<void()> &pump = {});
+
+      public:
+        [[sc::thread_safe]] void submit(task, priority = priority::normal);
+        [[sc::thread_safe]] std::shared_ptr<strand> make_strand(std::size_t limit);
+    };
+
+    class executor::strand : public std::enable_shared_from_this<strand>
+    {
+        using clock = std::chrono::steady_clock;
+
+        struct pending
+        {
+            clock::time_point since;
+            saucer::priority priority;
+            task callback;
+        };
+
+        struct state
+        {
+            std::size_t running{0};
+            std::size_t queued{0};
+            lanes<pending> waiting;
+
+          public:
+            std::uint64_t completed{0};
+
+          public:
+            std::chrono::nanoseconds total_wait{0};
+            std::chrono::nanoseconds max_wait{0};
+        };
+
+      private:
+        executor *m_parent;
+        std::size_t m_limit;
+
+      private:
+        lockpp::lock<state> m_state;
+
+      public:
+        strand(executor *parent, std::size_t limit);
+
+      private:
+        void dispatch();
+
+      public:
+        [[sc::thread_safe]] void post(task, priority = priority::normal);
+        [[sc::thread_safe]] execution_stats stats();
+    };
+
+    template <typename T>
+    std::optional<T> pop(executor::lanes<T> &lanes)
+    {
+        //? Lanes are indexed by priority, the highest non-empty lane is served first.
+
+        for (auto it = lanes.rbegin(); it != lanes.rend(); it++)
+        {
+            if (it->empty())
+            {
+                continue;
+            }
+
+            auto rtn = std::move(it->front());
+            it->pop_front();
+
+            return rtn;
+        }
+
+        return std::nullopt;
+    }
+} // namespace saucer
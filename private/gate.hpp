@@ -0,0 +1,75 @@
+#pragma once
+
+#include "utils/policy.hpp"
+
+#include <deque>
+#include <vector>
+#include <chrono>
+#include <optional>
+#include <functional>
+
+#include <lockpp/lock.hpp>
+
+namespace saucer
+{
+    class gate
+    {
+        using task  = std::function<void()>;
+        using clock = std::chrono::steady_clock;
+
+      public:
+        enum class verdict
+        {
+            admitted,
+            queued,
+            rejected,
+        };
+
+      private:
+        struct state
+        {
+            saucer::limits limits;
+            admission_stats stats{};
+
+          public:
+            double tokens{0};
+            clock::time_point refilled{clock::now()};
+
+          public:
+            bool retrying{false};
+            std::size_t in_flight{0};
+            std::deque<task> backlog;
+        };
+
+      private:
+        lockpp::lock<state> m_state;
+
+      private:
+        static void refill(state &);
+        static bool take(state &);
+        static std::optional<task> next(state &);
+
+      public:
+        [[sc::thread_safe]] void configure(const limits &);
+        [[sc::thread_safe]] admission_stats stats();
+
+      public:
+        //? When the call can not be admitted right away and a `deferred` task is given, it may be queued instead. The
+        //? task is then returned by a later call to `leave` or `poll` and is already admitted at that point. Queued
+        //? tasks are admitted strictly in order, no call is admitted while older ones are still waiting.
+
+        [[sc::thread_safe]] verdict enter(task *deferred = nullptr);
+        [[sc::thread_safe]] std::optional<task> leave();
+
+      public:
+        //? Queued tasks need a token just like any other call. Should they be waiting for one, `retry` returns how long
+        //? to wait before calling `poll`, but only to the first caller until `poll` was called.
+
+        [[sc::thread_safe]] std::optional<task> poll();
+        [[sc::thread_safe]] std::optional<clock::duration> retry();
+
+      public:
+        //? Admits every queued task regardless of the limits, used to let them finish on shutdown.
+        [[sc::thread_safe]] std::vector<task> flush();
+    };
+} // namespace saucer
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <span>
+#include <memory>
+#include <cstdint>
+#include <filesystem>
+
+namespace saucer
+{
+    //? A read-only memory mapping of a file. Pages are only loaded once they are read, so serving a small part of a
+    //? large file does not read the whole file.
+
+    class mapped_file
+    {
+        struct impl;
+
+      private:
+        std::unique_ptr<impl> m_impl;
+        std::span<const std::uint8_t> m_data;
+
+      private:
+        mapped_file();
+
+      public:
+        ~mapped_file();
+
+      public:
+        [[nodiscard]] std::span<const std::uint8_t> data() const;
+
+      public:
+        [[nodiscard]] static std::shared_ptr<mapped_file> open(const std::filesystem::path &);
+    };
+} // namespace saucer
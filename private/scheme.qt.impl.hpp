@@ -0,0 +1,113 @@
+#pragma once
+
+#include "scheme.hpp"
+
+#include <mutex>
+#include <memory>
+#include <condition_variable>
+
+#include <QObject>
+#include <QPointer>
+#include <QIODevice>
+#include <QByteArray>
+#include <QWebEngineUrlRequestJob>
+
+namespace saucer
+{
+    //! Sequential device that is filled by a scheme_stream from any thread and read by QtWebEngine on the UI thread.
+    //! The device is created on the UI thread, the stream only ever posts to it while holding the state lock, which
+    //! the device also takes on destruction.
+
+    class stream_device : public QIODevice
+    {
+      public:
+        struct state
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+
+          public:
+            QByteArray buffer;
+            bool finished{false};
+
+          public:
+            stream_device *device{nullptr};
+
+          public:
+            void cancel();
+        };
+
+      private:
+        std::shared_ptr<state> m_state;
+        QPointer<QWebEngineUrlRequestJob> m_request;
+
+      public:
+        stream_device(QWebEngineUrlRequestJob *request);
+
+      public:
+        ~stream_device() override;
+
+      public:
+        [[nodiscard]] std::shared_ptr<state> shared() const;
+
+      public:
+        void fail();
+        void notify();
+        void reply(const QByteArray &mime);
+
+      public:
+        [[nodiscard]] bool atEnd() const override;
+        [[nodiscard]] bool isSequential() const override;
+        [[nodiscard]] qint64 bytesAvailable() const override;
+
+      protected:
+        qint64 readData(char *data, qint64 max_size) override;
+        qint64 writeData(const char *data, qint64 max_size) override;
+    };
+
+    struct scheme_stream::impl
+    {
+        std::shared_ptr<stream_device::state> state;
+
+      public:
+        std::mutex mutex;
+        bool started{false};
+        bool done{false};
+
+      public:
+        ~impl();
+
+      public:
+        template <typename Func>
+        bool post(Func &&);
+
+      public:
+        bool start(std::string_view mime);
+        bool write(const char *data, std::size_t size);
+
+      public:
+        void finish();
+        void fail();
+    };
+
+    template <typename Func>
+    bool scheme_stream::impl::post(Func &&func)
+    {
+        std::lock_guard guard{state->mutex};
+
+        if (!state->device)
+        {
+            return false;
+        }
+
+        auto *device  = state->device;
+        auto callback = [device, func = std::forward<Func>(func)]
+        {
+            func(device);
+        };
+
+        QMetaObject::invokeMethod(device, callback, Qt::QueuedConnection);
+
+        return true;
+    }
+} // namespace saucer
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "scheme.hpp"
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <optional>
+#include <functional>
+#include <condition_variable>
+
+#include <wrl.h>
+#include <objidl.h>
+
+namespace saucer
+{
+    //! Stream that is filled by a scheme_stream from any thread and read by WebView2 on one of its background threads.
+    //! Reads block until data arrives, the response is finished or the stream is cancelled. The reader is handed to
+    //! the engine as the body of the response as soon as the handler started it.
+
+    class stream_reader
+        : public Microsoft::WRL::RuntimeClass<Microsoft::WRL::RuntimeClassFlags<Microsoft::WRL::ClassicCom>, IStream>
+    {
+      public:
+        struct state
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+
+          public:
+            std::string buffer;
+            std::size_t offset{0};
+
+          public:
+            bool finished{false};
+            bool failed{false};
+            bool cancelled{false};
+
+          public:
+            void cancel();
+        };
+
+      private:
+        std::shared_ptr<state> m_state;
+        ULONGLONG m_position{0};
+
+      public:
+        stream_reader(std::shared_ptr<state> state);
+
+      public:
+        ~stream_reader();
+
+      public:
+        HRESULT STDMETHODCALLTYPE Read(void *data, ULONG size, ULONG *read) override;
+        HRESULT STDMETHODCALLTYPE Write(const void *data, ULONG size, ULONG *written) override;
+
+      public:
+        HRESULT STDMETHODCALLTYPE Seek(LARGE_INTEGER move, DWORD origin, ULARGE_INTEGER *position) override;
+        HRESULT STDMETHODCALLTYPE SetSize(ULARGE_INTEGER size) override;
+        HRESULT STDMETHODCALLTYPE CopyTo(IStream *, ULARGE_INTEGER, ULARGE_INTEGER *, ULARGE_INTEGER *) override;
+
+      public:
+        HRESULT STDMETHODCALLTYPE Commit(DWORD flags) override;
+        HRESULT STDMETHODCALLTYPE Revert() override;
+
+      public:
+        HRESULT STDMETHODCALLTYPE LockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD) override;
+        HRESULT STDMETHODCALLTYPE UnlockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD) override;
+
+      public:
+        HRESULT STDMETHODCALLTYPE Stat(STATSTG *stat, DWORD flags) override;
+        HRESULT STDMETHODCALLTYPE Clone(IStream **stream) override;
+    };
+
+    //! The response is handed to the engine once the handler starts it, a response that fails before it was started
+    //! is answered with an error instead. The callback is expected to post the response to the UI thread.
+
+    struct scheme_stream::impl
+    {
+        using respond_t = std::function<void(std::optional<std::string> mime, Microsoft::WRL::ComPtr<IStream> body)>;
+
+      public:
+        std::mutex mutex;
+        respond_t respond;
+
+      public:
+        std::shared_ptr<stream_reader::state> state;
+
+      public:
+        bool started{false};
+        bool done{false};
+
+      public:
+        impl(respond_t);
+
+      public:
+        ~impl();
+
+      public:
+        void cancel();
+
+      public:
+        bool start(std::string_view mime);
+        bool write(const char *data, std::size_t size);
+
+      public:
+        void finish();
+        void fail();
+    };
+} // namespace saucer
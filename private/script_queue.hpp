@@ -0,0 +1,58 @@
+#pragma once
+
+#include "webview.hpp"
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace saucer
+{
+    //? Holds the scripts that are executed before the DOM is ready, so that they can all be flushed at once when it
+    //? is. Only ever used on the UI thread. When more than `limit` user scripts are queued the oldest ones are
+    //? dropped, internal scripts (i.e. the bridge or pending evaluations) are always kept.
+
+    class script_queue
+    {
+        struct entry
+        {
+            std::string script;
+            bool internal;
+        };
+
+      private:
+        std::deque<entry> m_scripts;
+
+      private:
+        std::size_t m_bytes{0};
+        std::size_t m_user{0};
+        std::size_t m_limit;
+        std::uint64_t m_dropped{0};
+
+      private:
+        void trim();
+
+      public:
+        static constexpr std::size_t default_limit = 4096;
+
+      public:
+        script_queue(std::size_t limit = default_limit);
+
+      public:
+        void push(std::string script, bool internal = false);
+        void set_limit(std::size_t limit);
+
+      public:
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] pending_stats stats() const;
+
+      public:
+        //? Empties the queue and returns what has to be executed, in order. Consecutive internal scripts are merged
+        //? into one batch in which every script runs in its own try-block, so that the bridge needs a single native
+        //? call. User scripts are returned as they are and are meant to be executed one by one, so that a user script
+        //? that does not parse can not take any other script down with it. No eval is involved, which keeps the flush
+        //? working on pages whose CSP forbids 'unsafe-eval'.
+        [[nodiscard]] std::vector<std::string> flush();
+    };
+} // namespace saucer
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <bit>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <tuple>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <optional>
+#include <functional>
+
+namespace saucer
+{
+    //? A sharded slot map. Keys encode the shard, the slot index and a generation counter, so that freed slots can be
+    //? reused without a stale key ever matching the new entry. Keys stay below 2^53 so that they can be passed to the
+    //? page as plain numbers. A slot whose generation is exhausted is retired instead of being reused, so generations
+    //? never wrap around.
+
+    template <typename T, std::size_t Shards = 16, std::size_t IndexBits = 20>
+    class slot_map
+    {
+        static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "The amount of shards must be a power of two");
+
+      public:
+        using key = std::uint64_t;
+
+      private:
+        static constexpr auto shard_bits      = static_cast<std::size_t>(std::bit_width(Shards - 1));
+        static constexpr auto index_bits      = IndexBits;
+        static constexpr auto generation_bits = 53 - index_bits - shard_bits;
+
+      private:
+        static_assert(index_bits <= 32 && generation_bits > 0 && generation_bits <= 32, "Bad key layout");
+
+      private:
+        static constexpr auto max_index      = (key{1} << index_bits) - 1;
+        static constexpr auto max_generation = (key{1} << generation_bits) - 1;
+
+      private:
+        struct slot
+        {
+            std::uint32_t generation{0};
+            std::optional<T> value;
+        };
+
+        struct shard
+        {
+            std::mutex mutex;
+
+          public:
+            std::vector<slot> slots;
+            std::vector<std::uint32_t> free;
+        };
+
+      private:
+        std::atomic_size_t m_size{0};
+        std::array<shard, Shards> m_shards;
+
+      private:
+        static std::size_t local_shard();
+        static void release(shard &, std::uint32_t index);
+
+      private:
+        static key make_key(std::size_t shard, std::uint32_t index, std::uint32_t generation);
+        static std::tuple<std::size_t, std::uint32_t, std::uint32_t> split_key(key);
+
+      public:
+        [[sc::thread_safe]] key insert(T value);
+
+      public:
+        [[sc::thread_safe]] std::optional<T> take(key);
+        [[sc::thread_safe]] std::vector<T> take_all();
+
+        template <typename Predicate>
+        [[sc::thread_safe]] std::vector<T> take_if(Predicate &&);
+
+      public:
+        template <typename Callback>
+        [[sc::thread_safe]] bool modify(key, Callback &&);
+
+        template <typename Callback>
+        [[sc::thread_safe]] void for_each(Callback &&);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::size_t size() const;
+    };
+} // namespace saucer
+
+#include "slot_map.inl"
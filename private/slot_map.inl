@@ -0,0 +1,206 @@
+#pragma once
+
+#include "slot_map.hpp"
+
+namespace saucer
+{
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    std::size_t slot_map<T, Shards, IndexBits>::local_shard()
+    {
+        //? Every thread inserts into its own shard, which keeps the UI thread and the workers apart.
+        static thread_local const auto rtn = std::hash<std::thread::id>{}(std::this_thread::get_id()) & (Shards - 1);
+        return rtn;
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    void slot_map<T, Shards, IndexBits>::release(shard &shard, std::uint32_t index)
+    {
+        auto &slot = shard.slots[index];
+
+        slot.value.reset();
+
+        //? A key with the next generation would wrap around and could match a stale key, the slot is retired instead.
+
+        if (slot.generation == max_generation)
+        {
+            return;
+        }
+
+        slot.generation++;
+        shard.free.emplace_back(index);
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    typename slot_map<T, Shards, IndexBits>::key slot_map<T, Shards, IndexBits>::make_key(std::size_t shard,
+                                                                                          std::uint32_t index,
+                                                                                          std::uint32_t generation)
+    {
+        auto rtn = static_cast<key>(generation);
+
+        rtn = (rtn << index_bits) | index;
+        rtn = (rtn << shard_bits) | shard;
+
+        return rtn;
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    std::tuple<std::size_t, std::uint32_t, std::uint32_t> slot_map<T, Shards, IndexBits>::split_key(key value)
+    {
+        const auto shard = static_cast<std::size_t>(value & (Shards - 1));
+        value >>= shard_bits;
+
+        const auto index = static_cast<std::uint32_t>(value & ((key{1} << index_bits) - 1));
+        value >>= index_bits;
+
+        return {shard, index, static_cast<std::uint32_t>(value)};
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    typename slot_map<T, Shards, IndexBits>::key slot_map<T, Shards, IndexBits>::insert(T value)
+    {
+        const auto id = local_shard();
+        auto &shard   = m_shards[id];
+
+        std::lock_guard guard{shard.mutex};
+
+        std::uint32_t index{};
+
+        if (!shard.free.empty())
+        {
+            index = shard.free.back();
+            shard.free.pop_back();
+        }
+        else if (shard.slots.size() <= max_index)
+        {
+            index = static_cast<std::uint32_t>(shard.slots.size());
+            shard.slots.emplace_back();
+        }
+        else
+        {
+            throw std::length_error{"Too many entries in slot map"};
+        }
+
+        auto &slot = shard.slots[index];
+        slot.value.emplace(std::move(value));
+
+        m_size.fetch_add(1, std::memory_order_relaxed);
+
+        return make_key(id, index, slot.generation);
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    std::optional<T> slot_map<T, Shards, IndexBits>::take(key value)
+    {
+        const auto [id, index, generation] = split_key(value);
+        auto &shard                        = m_shards[id];
+
+        std::lock_guard guard{shard.mutex};
+
+        if (index >= shard.slots.size())
+        {
+            return std::nullopt;
+        }
+
+        auto &slot = shard.slots[index];
+
+        if (slot.generation != generation || !slot.value)
+        {
+            return std::nullopt;
+        }
+
+        auto rtn = std::move(slot.value);
+
+        release(shard, index);
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+
+        return rtn;
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    std::vector<T> slot_map<T, Shards, IndexBits>::take_all()
+    {
+        return take_if([](const auto &) { return true; });
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    template <typename Predicate>
+    std::vector<T> slot_map<T, Shards, IndexBits>::take_if(Predicate &&predicate)
+    {
+        std::vector<T> rtn;
+
+        for (auto id = 0u; Shards > id; id++)
+        {
+            auto &shard = m_shards[id];
+            std::lock_guard guard{shard.mutex};
+
+            for (auto index = 0u; shard.slots.size() > index; index++)
+            {
+                auto &slot = shard.slots[index];
+
+                if (!slot.value || !std::invoke(predicate, std::as_const(*slot.value)))
+                {
+                    continue;
+                }
+
+                rtn.emplace_back(std::move(*slot.value));
+
+                release(shard, index);
+                m_size.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        return rtn;
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    template <typename Callback>
+    bool slot_map<T, Shards, IndexBits>::modify(key value, Callback &&callback)
+    {
+        const auto [id, index, generation] = split_key(value);
+        auto &shard                        = m_shards[id];
+
+        std::lock_guard guard{shard.mutex};
+
+        if (index >= shard.slots.size())
+        {
+            return false;
+        }
+
+        auto &slot = shard.slots[index];
+
+        if (slot.generation != generation || !slot.value)
+        {
+            return false;
+        }
+
+        std::invoke(std::forward<Callback>(callback), *slot.value);
+
+        return true;
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    template <typename Callback>
+    void slot_map<T, Shards, IndexBits>::for_each(Callback &&callback)
+    {
+        for (auto &shard : m_shards)
+        {
+            std::lock_guard guard{shard.mutex};
+
+            for (auto &slot : shard.slots)
+            {
+                if (!slot.value)
+                {
+                    continue;
+                }
+
+                std::invoke(callback, *slot.value);
+            }
+        }
+    }
+
+    template <typename T, std::size_t Shards, std::size_t IndexBits>
+    std::size_t slot_map<T, Shards, IndexBits>::size() const
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+} // namespace saucer
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <span>
+#include <memory>
+#include <cstdint>
+
+#include <QIODevice>
+
+namespace saucer
+{
+    //! Read-only device that serves the given span in place.
+    //! The data has to outlive the device, unless an owner that keeps it alive is given.
+    //! Used to reply with embedded files, which live in static storage, without copying them first.
+
+    class span_device : public QIODevice
+    {
+        std::span<const std::uint8_t> m_data;
+        std::shared_ptr<const void> m_owner;
+
+      public:
+        span_device(std::span<const std::uint8_t> data, std::shared_ptr<const void> owner = nullptr,
+                    QObject *parent = nullptr);
+
+      public:
+        [[nodiscard]] bool isSequential() const override;
+        [[nodiscard]] qint64 size() const override;
+        [[nodiscard]] qint64 bytesAvailable() const override;
+
+      protected:
+        qint64 readData(char *data, qint64 max_size) override;
+        qint64 writeData(const char *data, qint64 max_size) override;
+    };
+} // namespace saucer
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "startup.hpp"
+
+#include <mutex>
+#include <chrono>
+
+namespace saucer
+{
+    //? Only the first time a phase is reached is recorded.
+
+    class startup_recorder
+    {
+        using clock = std::chrono::steady_clock;
+
+      private:
+        mutable std::mutex m_mutex;
+
+      private:
+        clock::time_point m_origin;
+        startup_timings m_timings;
+
+      public:
+        startup_recorder();
+
+      public:
+        [[sc::thread_safe]] void record(startup_phase);
+        [[sc::thread_safe]] [[nodiscard]] startup_timings timings() const;
+    };
+} // namespace saucer
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+#include <functional>
+#include <condition_variable>
+
+namespace saucer
+{
+    class timer
+    {
+        using task  = std::function<void()>;
+        using clock = std::chrono::steady_clock;
+        using key   = std::pair<clock::time_point, std::uint64_t>;
+
+      private:
+        mutable std::mutex m_mutex;
+        std::condition_variable m_cv;
+
+      private:
+        bool m_stop{false};
+        std::uint64_t m_counter{0};
+
+      private:
+        std::map<key, task> m_tasks;
+        std::map<std::uint64_t, clock::time_point> m_deadlines;
+
+      private:
+        std::thread m_thread;
+        std::atomic_bool m_finished{false};
+
+      public:
+        ~timer();
+
+      private:
+        void work();
+
+      public:
+        //? Tasks are run on the timer thread, the thread is only started once the first task is scheduled.
+
+        [[sc::thread_safe]] std::uint64_t schedule(clock::duration delay, task callback);
+        [[sc::thread_safe]] void cancel(std::uint64_t id);
+
+      public:
+        //? Asks the timer thread to exit without waiting for it, pending tasks are dropped.
+
+        [[sc::thread_safe]] void stop();
+        [[sc::thread_safe]] [[nodiscard]] bool finished() const;
+    };
+} // namespace saucer
@@ -1,9 +1,16 @@
 #pragma once
 
 #include "webview.hpp"
+#include "asset_cache.hpp"
+#include "script_queue.hpp"
+#include "executor.hpp"
+#include "asset_directory.hpp"
+#include "scheme.qt.impl.hpp"
 
 #include <string>
 #include <vector>
+#include <chrono>
+#include <functional>
 #include <string_view>
 
 #include <QMetaObject>
@@ -37,20 +44,46 @@ namespace saucer
 
       public:
         bool dom_loaded{false};
-        std::vector<std::string> pending;
+        script_queue pending;
+
+      public:
+        bool startup_injected{false};
+
+      public:
+        asset_cache assets;
+        asset_directory::directories directories;
+
+      public:
+        std::vector<std::weak_ptr<stream_device::state>> streams;
 
       public:
         QMetaObject::Connection url_changed;
         QMetaObject::Connection load_finished;
 
+      public:
+        //? How long the destructor waits for response handlers that are still running before detaching them.
+        std::chrono::milliseconds handler_timeout{5000};
+        std::function<void(std::size_t)> on_abandon;
+
+      public:
+        //? Runs response handlers, declared last so that it is joined before the rest of the impl is torn down.
+        std::unique_ptr<executor> workers;
+
+      public:
+        void inject_startup();
+        void install_scheme_handler(webview *);
+
       public:
         template <web_event>
         void setup(webview *);
 
       public:
-        static const std::string ready_script;
-        static const std::string inject_script;
         static constexpr std::string_view scheme_prefix = "saucer:/";
+
+      public:
+        //? The bridge and the ready notification in one script. It is assembled and injected on the first navigation,
+        //? see `inject_startup`, rather than during construction.
+        static const std::string &inject_script();
     };
 
     class webview::impl::web_class : public QObject
@@ -1,10 +1,17 @@
 #pragma once
 
 #include "webview.hpp"
+#include "executor.hpp"
+#include "asset_cache.hpp"
+#include "script_queue.hpp"
+#include "asset_directory.hpp"
+#include "scheme.webview2.impl.hpp"
 
 #include <any>
 #include <optional>
 #include <concepts>
+#include <chrono>
+#include <functional>
 #include <string_view>
 
 #include <wrl.h>
@@ -31,7 +38,7 @@ namespace saucer
         std::vector<LPCWSTR> injected;
 
       public:
-        std::vector<std::string> pending;
+        script_queue pending;
         std::vector<std::string> scripts;
 
       public:
@@ -42,10 +49,27 @@ namespace saucer
       public:
         bool dom_loaded{false};
 
+      public:
+        asset_cache assets;
+        asset_directory::directories directories;
+
+      public:
+        std::vector<std::weak_ptr<scheme_stream::impl>> streams;
+
+      public:
+        //? How long the destructor waits for response handlers that are still running before detaching them.
+        std::chrono::milliseconds handler_timeout{5000};
+        std::function<void(std::size_t)> on_abandon;
+
+      public:
+        //? Runs response handlers, destroyed before the rest of the impl.
+        std::unique_ptr<executor> workers;
+
       public:
         static constinit std::string_view inject_script;
         static constexpr std::string_view scheme_prefix = "saucer://embedded/";
 
+
       public:
         void overwrite_wnd_proc(HWND hwnd);
         void install_scheme_handler(webview *);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "window.hpp"
+#include "startup_recorder.hpp"
 
 #include <future>
 #include <optional>
@@ -26,6 +27,9 @@ namespace saucer
         std::function<void()> on_closed;
         std::optional<QSize> max_size, min_size;
 
+      public:
+        startup_recorder startup;
+
       public:
         [[nodiscard]] bool is_thread_safe() const;
 
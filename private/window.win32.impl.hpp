@@ -1,6 +1,7 @@
 #pragma once
 
 #include "window.hpp"
+#include "startup_recorder.hpp"
 
 #include <thread>
 #include <future>
@@ -24,6 +25,9 @@ namespace saucer
       public:
         std::optional<std::pair<int, int>> max_size, min_size;
 
+      public:
+        startup_recorder startup;
+
       public:
         [[nodiscard]] bool is_thread_safe() const;
         [[nodiscard]] std::pair<int, int> window_offset() const;
@@ -38,6 +42,10 @@ namespace saucer
       public:
         template <typename Func>
         auto post_safe(Func &&);
+
+      public:
+        template <typename Func>
+        void post(Func &&);
     };
 
     struct message
@@ -72,6 +80,34 @@ namespace saucer
         }
     };
 
+    class post_message : public message
+    {
+        using callback_t = std::function<void()>;
+
+      private:
+        callback_t m_func;
+
+      public:
+        post_message(callback_t &&func) : m_func(std::move(func)) {}
+
+      public:
+        void release()
+        {
+            m_func = nullptr;
+        }
+
+      public:
+        ~post_message() override
+        {
+            if (!m_func)
+            {
+                return;
+            }
+
+            m_func();
+        }
+    };
+
     template <typename Func>
     auto window::impl::post_safe(Func &&func)
     {
@@ -85,4 +121,19 @@ namespace saucer
 
         return result.get_future().get();
     }
+
+    template <typename Func>
+    void window::impl::post(Func &&func)
+    {
+        auto *message = new post_message(std::forward<Func>(func));
+
+        if (PostMessage(hwnd, WM_SAFE_CALL, 0, reinterpret_cast<LPARAM>(message)))
+        {
+            return;
+        }
+
+        //? The window is gone, the callback must not run on this thread instead.
+        message->release();
+        delete message;
+    }
 } // namespace saucer
@@ -0,0 +1,117 @@
+#include "asset_cache.hpp"
+
+#ifdef SAUCER_BROTLI
+#include <brotli/decode.h>
+#endif
+
+namespace saucer
+{
+    asset_cache::asset_cache(std::size_t limit) : m_limit(limit) {}
+
+    void asset_cache::evict()
+    {
+        while (m_size > m_limit && !m_entries.empty())
+        {
+            auto &[key, value] = m_entries.back();
+
+            m_size -= value->size();
+            m_index.erase(key);
+
+            m_entries.pop_back();
+        }
+    }
+
+    std::shared_ptr<const asset_cache::buffer> asset_cache::decode([[maybe_unused]] const embedded_entry &entry)
+    {
+#ifdef SAUCER_BROTLI
+        if (entry.encoding == embedded_encoding::brotli)
+        {
+            auto rtn  = std::make_shared<buffer>(entry.size);
+            auto size = rtn->size();
+
+            const auto result =
+                BrotliDecoderDecompress(entry.content.size(), entry.content.data(), &size, rtn->data());
+
+            if (result != BROTLI_DECODER_RESULT_SUCCESS || size != rtn->size())
+            {
+                return nullptr;
+            }
+
+            return rtn;
+        }
+#endif
+
+        return nullptr;
+    }
+
+    std::optional<asset> asset_cache::load(const embedded_entry &entry)
+    {
+        if (entry.encoding == embedded_encoding::identity)
+        {
+            return asset{entry.content, nullptr};
+        }
+
+        const auto *key = entry.content.data();
+
+        {
+            std::lock_guard guard{m_mutex};
+
+            if (auto it = m_index.find(key); it != m_index.end())
+            {
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                const auto &value = it->second->second;
+
+                return asset{*value, value};
+            }
+        }
+
+        //? Decoding happens outside of the lock, concurrent misses for the same file may decode it twice, which is
+        //? cheaper than serializing all requests behind one decode.
+
+        auto decoded = decode(entry);
+
+        if (!decoded)
+        {
+            return std::nullopt;
+        }
+
+        std::lock_guard guard{m_mutex};
+
+        if (decoded->size() > m_limit || m_index.contains(key))
+        {
+            return asset{*decoded, decoded};
+        }
+
+        m_entries.emplace_front(key, decoded);
+        m_index.emplace(key, m_entries.begin());
+
+        m_size += decoded->size();
+        evict();
+
+        return asset{*decoded, decoded};
+    }
+
+    void asset_cache::clear()
+    {
+        std::lock_guard guard{m_mutex};
+
+        m_index.clear();
+        m_entries.clear();
+
+        m_size = 0;
+    }
+
+    void asset_cache::set_limit(std::size_t limit)
+    {
+        std::lock_guard guard{m_mutex};
+
+        m_limit = limit;
+        evict();
+    }
+
+    std::size_t asset_cache::size()
+    {
+        std::lock_guard guard{m_mutex};
+        return m_size;
+    }
+} // namespace saucer
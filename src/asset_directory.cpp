@@ -0,0 +1,357 @@
+#include "asset_directory.hpp"
+
+#include <fstream>
+#include <algorithm>
+#include <functional>
+
+namespace saucer
+{
+    namespace fs = std::filesystem;
+
+    namespace
+    {
+        std::string to_string(const fs::path &path)
+        {
+            const auto rtn = path.generic_u8string();
+            return {reinterpret_cast<const char *>(rtn.data()), rtn.size()};
+        }
+
+        std::optional<std::string> decode(std::string_view path)
+        {
+            std::string rtn;
+            rtn.reserve(path.size());
+
+            auto hex = [](char c) -> int
+            {
+                if (c >= '0' && c <= '9')
+                {
+                    return c - '0';
+                }
+
+                if (c >= 'a' && c <= 'f')
+                {
+                    return c - 'a' + 10;
+                }
+
+                if (c >= 'A' && c <= 'F')
+                {
+                    return c - 'A' + 10;
+                }
+
+                return -1;
+            };
+
+            for (auto i = 0u; path.size() > i; i++)
+            {
+                if (path[i] != '%')
+                {
+                    rtn += path[i];
+                    continue;
+                }
+
+                if (i + 2 >= path.size() || hex(path[i + 1]) < 0 || hex(path[i + 2]) < 0)
+                {
+                    return std::nullopt;
+                }
+
+                rtn += static_cast<char>((hex(path[i + 1]) << 4) | hex(path[i + 2]));
+                i += 2;
+            }
+
+            return rtn;
+        }
+
+        bool contains(const fs::path &base, const fs::path &target)
+        {
+            return std::mismatch(base.begin(), base.end(), target.begin(), target.end()).first == base.end();
+        }
+
+        std::optional<directory_file> inspect(const fs::path &path)
+        {
+            std::error_code ec;
+
+            if (!fs::is_regular_file(path, ec))
+            {
+                return std::nullopt;
+            }
+
+            const auto size     = fs::file_size(path, ec);
+            const auto modified = ec ? fs::file_time_type{} : fs::last_write_time(path, ec);
+
+            if (ec)
+            {
+                return std::nullopt;
+            }
+
+            return directory_file{path, {}, static_cast<std::size_t>(size), modified};
+        }
+
+        std::optional<asset> read(const fs::path &path, std::size_t size)
+        {
+            std::ifstream stream{path, std::ios::binary};
+
+            if (!stream)
+            {
+                return std::nullopt;
+            }
+
+            auto content = std::make_shared<std::vector<std::uint8_t>>(size);
+
+            stream.read(reinterpret_cast<char *>(content->data()), static_cast<std::streamsize>(size));
+            content->resize(static_cast<std::size_t>(stream.gcount()));
+
+            return asset{std::span<const std::uint8_t>{*content}, content};
+        }
+    } // namespace
+
+    std::size_t asset_directory::hash::operator()(std::string_view value) const
+    {
+        return std::hash<std::string_view>{}(value);
+    }
+
+    asset_directory::asset_directory(const fs::path &root, std::size_t budget) : m_budget(budget)
+    {
+        std::error_code ec;
+
+        m_root = fs::canonical(root, ec);
+
+        if (ec)
+        {
+            m_root.clear();
+            return;
+        }
+
+        //? Symlinked directories are not followed. Symlinked files are only served when they resolve to a file inside
+        //? of the root, and are then served from their resolved path.
+
+        auto it = fs::recursive_directory_iterator{m_root, fs::directory_options::skip_permission_denied, ec};
+
+        for (; !ec && it != fs::recursive_directory_iterator{}; it.increment(ec))
+        {
+            if (!it->is_regular_file(ec))
+            {
+                ec.clear();
+                continue;
+            }
+
+            auto target = fs::canonical(it->path(), ec);
+
+            if (ec || !contains(m_root, target))
+            {
+                ec.clear();
+                continue;
+            }
+
+            auto file = inspect(target);
+
+            if (!file)
+            {
+                continue;
+            }
+
+            auto [entry, _] = m_index.emplace(to_string(it->path().lexically_relative(m_root)), std::move(*file));
+            entry->second.mime = detail::embedded::mime(entry->first);
+        }
+    }
+
+    std::optional<directory_file> asset_directory::lookup(const std::string &path)
+    {
+        std::optional<directory_file> rtn;
+
+        {
+            std::lock_guard guard{m_mutex};
+
+            if (auto it = m_index.find(path); it != m_index.end())
+            {
+                rtn.emplace(it->second);
+            }
+        }
+
+        if (!rtn)
+        {
+            return std::nullopt;
+        }
+
+        auto current = inspect(rtn->path);
+
+        if (current && current->size == rtn->size && current->modified == rtn->modified)
+        {
+            return rtn;
+        }
+
+        std::lock_guard guard{m_mutex};
+
+        if (auto it = m_lookup.find(to_string(rtn->path)); it != m_lookup.end())
+        {
+            evict(it->second);
+        }
+
+        if (!current)
+        {
+            m_index.erase(path);
+            return std::nullopt;
+        }
+
+        current->mime = rtn->mime;
+
+        if (auto it = m_index.find(path); it != m_index.end())
+        {
+            it->second = *current;
+        }
+
+        return current;
+    }
+
+    std::optional<directory_file> asset_directory::discover(const std::string &path)
+    {
+        if (m_root.empty())
+        {
+            return std::nullopt;
+        }
+
+        const auto relative =
+            fs::path{std::u8string{reinterpret_cast<const char8_t *>(path.data()), path.size()}}.lexically_normal();
+
+        if (relative.empty() || relative.has_root_path() || *relative.begin() == "..")
+        {
+            return std::nullopt;
+        }
+
+        std::error_code ec;
+        auto target = fs::canonical(m_root / relative, ec);
+
+        if (ec || !contains(m_root, target))
+        {
+            return std::nullopt;
+        }
+
+        auto rtn = inspect(target);
+
+        if (!rtn)
+        {
+            return std::nullopt;
+        }
+
+        rtn->mime = detail::embedded::mime(path);
+
+        std::lock_guard guard{m_mutex};
+        m_index.insert_or_assign(path, *rtn);
+
+        return rtn;
+    }
+
+    void asset_directory::evict(std::list<loaded>::iterator it)
+    {
+        m_resident -= it->content.content.size();
+
+        m_lookup.erase(it->key);
+        m_loaded.erase(it);
+    }
+
+    std::optional<directory_file> asset_directory::find(std::string_view path)
+    {
+        std::vector<std::string> candidates{std::string{path}};
+
+        if (path.find('%') != std::string_view::npos)
+        {
+            if (auto decoded = decode(path); decoded)
+            {
+                candidates.emplace_back(std::move(*decoded));
+            }
+        }
+
+        for (const auto &candidate : candidates)
+        {
+            if (auto rtn = lookup(candidate); rtn)
+            {
+                return rtn;
+            }
+        }
+
+        //? The file may have been created after the directory was indexed.
+
+        for (const auto &candidate : candidates)
+        {
+            if (auto rtn = discover(candidate); rtn)
+            {
+                return rtn;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::tuple<asset_directory *, std::optional<directory_file>> asset_directory::find(const directories &directories,
+                                                                                      std::string_view path)
+    {
+        for (const auto &directory : directories)
+        {
+            if (auto file = directory->find(path); file)
+            {
+                return {directory.get(), std::move(file)};
+            }
+        }
+
+        return {nullptr, std::nullopt};
+    }
+
+    std::optional<asset> asset_directory::load(const directory_file &file)
+    {
+        const auto key = to_string(file.path);
+
+        {
+            std::lock_guard guard{m_mutex};
+
+            if (auto it = m_lookup.find(key); it != m_lookup.end())
+            {
+                const auto &cached = it->second->file;
+
+                if (cached.size == file.size && cached.modified == file.modified)
+                {
+                    m_loaded.splice(m_loaded.begin(), m_loaded, it->second);
+                    return it->second->content;
+                }
+
+                //? The file changed since it was loaded, the stale content is still served to whoever holds it.
+                evict(it->second);
+            }
+        }
+
+        std::optional<asset> rtn;
+
+        if (file.size <= read_limit)
+        {
+            rtn = read(file.path, file.size);
+        }
+        else if (auto mapped = mapped_file::open(file.path); mapped)
+        {
+            rtn = asset{mapped->data(), mapped};
+        }
+
+        if (!rtn)
+        {
+            return std::nullopt;
+        }
+
+        const auto size = rtn->content.size();
+
+        std::lock_guard guard{m_mutex};
+
+        if (size > m_budget || m_lookup.contains(key))
+        {
+            return rtn;
+        }
+
+        m_loaded.emplace_front(loaded{key, file, *rtn});
+        m_lookup.emplace(key, m_loaded.begin());
+
+        m_resident += size;
+
+        while (m_resident > m_budget && !m_loaded.empty())
+        {
+            evict(std::prev(m_loaded.end()));
+        }
+
+        return rtn;
+    }
+} // namespace saucer
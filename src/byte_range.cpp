@@ -0,0 +1,93 @@
+#include "byte_range.hpp"
+
+#include <charconv>
+#include <algorithm>
+
+namespace saucer
+{
+    namespace
+    {
+        std::optional<std::size_t> parse_number(std::string_view value)
+        {
+            std::size_t rtn{};
+            const auto *end = value.data() + value.size();
+
+            if (value.empty() || std::from_chars(value.data(), end, rtn).ptr != end)
+            {
+                return std::nullopt;
+            }
+
+            return rtn;
+        }
+    } // namespace
+
+    std::pair<range_result, byte_range> parse_range(std::string_view header, std::size_t size, std::size_t max_length)
+    {
+        static constexpr std::string_view unit = "bytes=";
+
+        const auto full = std::make_pair(range_result::full, byte_range{0, size ? size - 1 : 0});
+
+        if (!header.starts_with(unit) || header.find(',') != std::string_view::npos)
+        {
+            return full;
+        }
+
+        header.remove_prefix(unit.size());
+        const auto dash = header.find('-');
+
+        if (dash == std::string_view::npos)
+        {
+            return full;
+        }
+
+        const auto first_part = header.substr(0, dash);
+        const auto last_part  = header.substr(dash + 1);
+
+        auto first = parse_number(first_part);
+        auto last  = parse_number(last_part);
+
+        //? Either side may be omitted, but a side that is present and not a number makes the whole header invalid
+        //? (e.g. "bytes=5-abc" is not "bytes=5-"), in which case it is ignored as per RFC 9110.
+
+        if ((!first && !first_part.empty()) || (!last && !last_part.empty()) || (!first && !last))
+        {
+            return full;
+        }
+
+        byte_range rtn{};
+
+        if (!first)
+        {
+            //? Suffix range, i.e. the last `n` bytes
+            if (*last == 0 || size == 0)
+            {
+                return {range_result::unsatisfiable, {}};
+            }
+
+            rtn = {size - std::min(*last, size), size - 1};
+        }
+        else
+        {
+            //? A range that ends before it starts is invalid rather than unsatisfiable and has to be ignored.
+
+            if (last && *last < *first)
+            {
+                return full;
+            }
+
+            if (*first >= size)
+            {
+                return {range_result::unsatisfiable, {}};
+            }
+
+            rtn = {*first, std::min(last.value_or(size - 1), size - 1)};
+        }
+
+        if (max_length > 0 && rtn.last - rtn.first + 1 > max_length)
+        {
+            rtn.last = rtn.first + max_length - 1;
+        }
+
+        return {range_result::partial, rtn};
+    }
+} // namespace saucer
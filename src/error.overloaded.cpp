@@ -0,0 +1,15 @@
+#include "serializers/errors/overloaded.hpp"
+
+#include <fmt/core.h>
+
+namespace saucer::errors
+{
+    overloaded::~overloaded() = default;
+
+    overloaded::overloaded(std::string function) : m_function(std::move(function)) {}
+
+    std::string overloaded::what()
+    {
+        return fmt::format("Too many calls to \"{}\", try again later", m_function);
+    }
+} // namespace saucer::errors
@@ -0,0 +1,12 @@
+#include "utils/exceptions.hpp"
+
+namespace saucer::exceptions
+{
+    navigation::navigation() : std::runtime_error("The page navigated before the evaluation completed") {}
+
+    released::released() : std::runtime_error("The handle was released or belongs to a previous page") {}
+
+    timeout::timeout() : std::runtime_error("The evaluation did not complete before its deadline") {}
+
+    closed::closed() : std::runtime_error("The smartview was closed before the evaluation completed") {}
+} // namespace saucer::exceptions
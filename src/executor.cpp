@@ -0,0 +1,209 @@
+#include "executor.hpp"
+
+#include <algorithm>
+
+namespace saucer
+{
+    executor::executor(std::size_t threads) : m_queue(std::make_shared<queue>())
+    {
+        m_workers.reserve(threads);
+        m_queue->active = threads;
+
+        for (auto i = 0u; threads > i; i++)
+        {
+            m_workers.emplace_back(
+                [queue = m_queue]
+                {
+                    while (true)
+                    {
+                        std::optional<task> current;
+
+                        {
+                            std::unique_lock guard{queue->mutex};
+                            queue->cv.wait(guard,
+                                           [&queue, &current] { return (current = pop(queue->tasks)) || queue->stop; });
+                        }
+
+                        if (!current)
+                        {
+                            break;
+                        }
+
+                        (*current)();
+                    }
+
+                    {
+                        std::lock_guard guard{queue->mutex};
+                        queue->active--;
+                    }
+
+                    queue->idle.notify_all();
+                });
+        }
+    }
+
+    executor::~executor()
+    {
+        {
+            std::lock_guard guard{m_queue->mutex};
+            m_queue->stop = true;
+        }
+
+        m_queue->cv.notify_all();
+
+        //? The executor may be destroyed by the last task of one of its own workers (i.e. when an abandoned call
+        //? releases the smartview), which can not join itself.
+
+        for (auto &worker : m_workers)
+        {
+            if (worker.get_id() == std::this_thread::get_id())
+            {
+                worker.detach();
+                continue;
+            }
+
+            worker.join();
+        }
+    }
+
+    std::size_t executor::shutdown(std::chrono::milliseconds timeout, const std::function<void()> &pump)
+    {
+        using clock = std::chrono::steady_clock;
+
+        static constexpr auto slice = std::chrono::milliseconds{10};
+
+        lanes<task> dropped;
+
+        {
+            std::lock_guard guard{m_queue->mutex};
+
+            m_queue->stop = true;
+            std::swap(dropped, m_queue->tasks);
+        }
+
+        m_queue->cv.notify_all();
+        dropped = {};
+
+        const auto deadline = clock::now() + timeout;
+        std::unique_lock guard{m_queue->mutex};
+
+        while (m_queue->active > 0)
+        {
+            const auto now = clock::now();
+
+            if (now >= deadline)
+            {
+                break;
+            }
+
+            if (pump)
+            {
+                guard.unlock();
+                pump();
+                guard.lock();
+            }
+
+            m_queue->idle.wait_for(guard, std::min<clock::duration>(slice, deadline - now));
+        }
+
+        const auto rtn = m_queue->active;
+        guard.unlock();
+
+        //? Busy workers only hold on to the shared queue, so they can safely finish on their own.
+
+        for (auto &worker : m_workers)
+        {
+            if (rtn > 0 || worker.get_id() == std::this_thread::get_id())
+            {
+                worker.detach();
+                continue;
+            }
+
+            worker.join();
+        }
+
+        m_workers.clear();
+
+        return rtn;
+    }
+
+    void executor::submit(task callback, priority priority)
+    {
+        {
+            std::lock_guard guard{m_queue->mutex};
+            m_queue->tasks[static_cast<std::size_t>(priority)].emplace_back(std::move(callback));
+        }
+
+        m_queue->cv.notify_one();
+    }
+
+    std::shared_ptr<executor::strand> executor::make_strand(std::size_t limit)
+    {
+        return std::make_shared<strand>(this, limit);
+    }
+
+    executor::strand::strand(executor *parent, std::size_t limit) : m_parent(parent), m_limit(limit) {}
+
+    void executor::strand::dispatch()
+    {
+        auto locked = m_state.write();
+
+        while (m_limit > locked->running && locked->queued > 0)
+        {
+            auto [since, priority, callback] = pop(locked->waiting).value();
+
+            locked->queued--;
+            locked->running++;
+
+            m_parent->submit(
+                [self = shared_from_this(), since, callback = std::move(callback)]()
+                {
+                    auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - since);
+
+                    {
+                        auto locked = self->m_state.write();
+
+                        locked->total_wait += waited;
+                        locked->max_wait = std::max(locked->max_wait, waited);
+                    }
+
+                    callback();
+
+                    {
+                        auto locked = self->m_state.write();
+
+                        locked->running--;
+                        locked->completed++;
+                    }
+
+                    self->dispatch();
+                },
+                priority);
+        }
+    }
+
+    void executor::strand::post(task callback, priority priority)
+    {
+        {
+            auto locked = m_state.write();
+
+            locked->waiting[static_cast<std::size_t>(priority)].emplace_back(clock::now(), priority, std::move(callback));
+            locked->queued++;
+        }
+
+        dispatch();
+    }
+
+    execution_stats executor::strand::stats()
+    {
+        auto locked = m_state.read();
+
+        return {
+            .queued     = locked->queued,
+            .running    = locked->running,
+            .completed  = locked->completed,
+            .total_wait = locked->total_wait,
+            .max_wait   = locked->max_wait,
+        };
+    }
+} // namespace saucer
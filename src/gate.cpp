@@ -0,0 +1,165 @@
+#include "gate.hpp"
+
+#include <iterator>
+#include <algorithm>
+
+namespace saucer
+{
+    void gate::configure(const limits &limits)
+    {
+        auto locked = m_state.write();
+
+        locked->limits   = limits;
+        locked->tokens   = static_cast<double>(limits.per_second.value_or(0));
+        locked->refilled = clock::now();
+    }
+
+    admission_stats gate::stats()
+    {
+        return m_state.read()->stats;
+    }
+
+    gate::verdict gate::enter(task *deferred)
+    {
+        auto locked        = m_state.write();
+        const auto &limits = locked->limits;
+
+        //? Calls are only admitted right away while nobody is waiting, a new call must not take the slot or the token
+        //? that an older call in the backlog is waiting for.
+
+        const auto full = limits.in_flight && locked->in_flight >= *limits.in_flight;
+
+        if (locked->backlog.empty() && !full && take(*locked))
+        {
+            locked->in_flight++;
+            locked->stats.admitted++;
+
+            return verdict::admitted;
+        }
+
+        //? A rate of zero never admits anything, queueing the call would only keep it waiting forever.
+
+        if (!deferred || locked->backlog.size() >= limits.backlog || limits.per_second == 0u)
+        {
+            locked->stats.rejected++;
+            return verdict::rejected;
+        }
+
+        locked->backlog.emplace_back(std::move(*deferred));
+        locked->stats.queued++;
+
+        return verdict::queued;
+    }
+
+    std::optional<gate::task> gate::leave()
+    {
+        auto locked = m_state.write();
+        locked->in_flight--;
+
+        return next(*locked);
+    }
+
+    std::optional<gate::task> gate::poll()
+    {
+        auto locked = m_state.write();
+        locked->retrying = false;
+
+        return next(*locked);
+    }
+
+    std::optional<gate::clock::duration> gate::retry()
+    {
+        auto locked        = m_state.write();
+        const auto &limits = locked->limits;
+
+        //? Tasks that wait for a free slot are picked up by `leave`, a retry is only needed when they wait for tokens.
+
+        if (locked->retrying || locked->backlog.empty() || !limits.per_second || *limits.per_second == 0)
+        {
+            return std::nullopt;
+        }
+
+        if (limits.in_flight && locked->in_flight >= *limits.in_flight)
+        {
+            return std::nullopt;
+        }
+
+        refill(*locked);
+        locked->retrying = true;
+
+        const auto missing = std::max(1 - locked->tokens, 0.0);
+        const auto seconds = std::chrono::duration<double>{missing / static_cast<double>(*limits.per_second)};
+
+        return std::chrono::ceil<clock::duration>(seconds);
+    }
+
+    std::vector<gate::task> gate::flush()
+    {
+        auto locked = m_state.write();
+
+        std::vector<task> rtn{std::make_move_iterator(locked->backlog.begin()),
+                              std::make_move_iterator(locked->backlog.end())};
+
+        locked->backlog.clear();
+
+        locked->in_flight += rtn.size();
+        locked->stats.admitted += rtn.size();
+
+        return rtn;
+    }
+
+    void gate::refill(state &state)
+    {
+        const auto now     = clock::now();
+        const auto elapsed = std::chrono::duration<double>(now - state.refilled).count();
+        const auto rate    = static_cast<double>(state.limits.per_second.value_or(0));
+
+        state.tokens   = std::min(rate, state.tokens + (elapsed * rate));
+        state.refilled = now;
+    }
+
+    bool gate::take(state &state)
+    {
+        if (!state.limits.per_second)
+        {
+            return true;
+        }
+
+        refill(state);
+
+        if (state.tokens < 1)
+        {
+            return false;
+        }
+
+        state.tokens -= 1;
+
+        return true;
+    }
+
+    std::optional<gate::task> gate::next(state &state)
+    {
+        if (state.backlog.empty())
+        {
+            return std::nullopt;
+        }
+
+        if (state.limits.in_flight && state.in_flight >= *state.limits.in_flight)
+        {
+            return std::nullopt;
+        }
+
+        if (!take(state))
+        {
+            return std::nullopt;
+        }
+
+        auto rtn = std::move(state.backlog.front());
+        state.backlog.pop_front();
+
+        state.in_flight++;
+        state.stats.admitted++;
+
+        return rtn;
+    }
+} // namespace saucer
@@ -0,0 +1,136 @@
+#include "mapped_file.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace saucer
+{
+    struct mapped_file::impl
+    {
+        void *address{nullptr};
+        std::size_t size{0};
+    };
+
+    mapped_file::mapped_file() : m_impl(std::make_unique<impl>()) {}
+
+    mapped_file::~mapped_file()
+    {
+        if (!m_impl->address)
+        {
+            return;
+        }
+
+#ifdef _WIN32
+        UnmapViewOfFile(m_impl->address);
+#else
+        munmap(m_impl->address, m_impl->size);
+#endif
+    }
+
+    std::span<const std::uint8_t> mapped_file::data() const
+    {
+        return m_data;
+    }
+
+#ifdef _WIN32
+    std::shared_ptr<mapped_file> mapped_file::open(const std::filesystem::path &path)
+    {
+        auto *file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        LARGE_INTEGER size{};
+
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        std::shared_ptr<mapped_file> rtn{new mapped_file};
+
+        if (size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return rtn;
+        }
+
+        auto *mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (!mapping)
+        {
+            return nullptr;
+        }
+
+        //? The view keeps the mapping alive, so both handles can be closed right away.
+        auto *address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+
+        if (!address)
+        {
+            return nullptr;
+        }
+
+        rtn->m_impl->address = address;
+        rtn->m_impl->size    = static_cast<std::size_t>(size.QuadPart);
+        rtn->m_data          = {static_cast<const std::uint8_t *>(address), rtn->m_impl->size};
+
+        return rtn;
+    }
+#else
+    std::shared_ptr<mapped_file> mapped_file::open(const std::filesystem::path &path)
+    {
+        const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        struct stat info
+        {
+        };
+
+        if (fstat(fd, &info) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        std::shared_ptr<mapped_file> rtn{new mapped_file};
+        const auto size = static_cast<std::size_t>(info.st_size);
+
+        if (size == 0)
+        {
+            close(fd);
+            return rtn;
+        }
+
+        //? The mapping stays valid after the descriptor is closed.
+        auto *address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (address == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        rtn->m_impl->address = address;
+        rtn->m_impl->size    = size;
+        rtn->m_data          = {static_cast<const std::uint8_t *>(address), size};
+
+        return rtn;
+    }
+#endif
+} // namespace saucer
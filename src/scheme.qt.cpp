@@ -0,0 +1,268 @@
+#include "scheme.qt.impl.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+namespace saucer
+{
+    //? Writers wait once this much data is buffered, so that a slow page does not make the buffer grow without bounds.
+    static constexpr auto high_water = 1024 * 1024;
+
+    void stream_device::state::cancel()
+    {
+        {
+            std::lock_guard guard{mutex};
+            device = nullptr;
+        }
+
+        cv.notify_all();
+    }
+
+    stream_device::stream_device(QWebEngineUrlRequestJob *request)
+        : m_state(std::make_shared<state>()), m_request(request)
+    {
+        m_state->device = this;
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
+
+    stream_device::~stream_device()
+    {
+        m_state->cancel();
+    }
+
+    std::shared_ptr<stream_device::state> stream_device::shared() const
+    {
+        return m_state;
+    }
+
+    void stream_device::fail()
+    {
+        if (!m_request)
+        {
+            return;
+        }
+
+        m_request->fail(QWebEngineUrlRequestJob::RequestFailed);
+    }
+
+    void stream_device::notify()
+    {
+        emit readyRead();
+
+        if (!atEnd())
+        {
+            return;
+        }
+
+        emit readChannelFinished();
+    }
+
+    void stream_device::reply(const QByteArray &mime)
+    {
+        if (!m_request)
+        {
+            return;
+        }
+
+        m_request->reply(mime, this);
+    }
+
+    bool stream_device::atEnd() const
+    {
+        std::lock_guard guard{m_state->mutex};
+        return m_state->finished && m_state->buffer.isEmpty();
+    }
+
+    bool stream_device::isSequential() const
+    {
+        return true;
+    }
+
+    qint64 stream_device::bytesAvailable() const
+    {
+        std::lock_guard guard{m_state->mutex};
+        return m_state->buffer.size() + QIODevice::bytesAvailable();
+    }
+
+    qint64 stream_device::readData(char *data, qint64 max_size)
+    {
+        std::unique_lock guard{m_state->mutex};
+        auto &buffer = m_state->buffer;
+
+        if (buffer.isEmpty())
+        {
+            return m_state->finished ? -1 : 0;
+        }
+
+        const auto count = std::min<qint64>(max_size, buffer.size());
+
+        std::memcpy(data, buffer.constData(), static_cast<std::size_t>(count));
+        buffer.remove(0, static_cast<int>(count));
+
+        guard.unlock();
+        m_state->cv.notify_all();
+
+        return count;
+    }
+
+    qint64 stream_device::writeData(const char *, qint64)
+    {
+        return -1;
+    }
+
+    scheme_stream::impl::~impl()
+    {
+        //? The last copy of the stream completes the response, which makes returning from a handler enough.
+
+        if (done)
+        {
+            return;
+        }
+
+        if (started)
+        {
+            finish();
+            return;
+        }
+
+        fail();
+    }
+
+    bool scheme_stream::impl::start(std::string_view mime)
+    {
+        {
+            std::lock_guard guard{mutex};
+
+            if (started || done)
+            {
+                return false;
+            }
+
+            started = true;
+        }
+
+        auto type = QByteArray{mime.data(), static_cast<int>(mime.size())};
+        return post([type](stream_device *device) { device->reply(type); });
+    }
+
+    bool scheme_stream::impl::write(const char *data, std::size_t size)
+    {
+        {
+            std::lock_guard guard{mutex};
+
+            if (!started || done)
+            {
+                return false;
+            }
+        }
+
+        {
+            std::unique_lock guard{state->mutex};
+            state->cv.wait(guard, [this] { return !state->device || state->buffer.size() < high_water; });
+
+            if (!state->device)
+            {
+                return false;
+            }
+
+            state->buffer.append(data, static_cast<int>(size));
+        }
+
+        return post([](stream_device *device) { device->notify(); });
+    }
+
+    void scheme_stream::impl::finish()
+    {
+        bool reply{false};
+
+        {
+            std::lock_guard guard{mutex};
+
+            if (done)
+            {
+                return;
+            }
+
+            reply   = !started;
+            started = true;
+            done    = true;
+        }
+
+        if (reply)
+        {
+            post([](stream_device *device) { device->reply("application/octet-stream"); });
+        }
+
+        {
+            std::lock_guard guard{state->mutex};
+            state->finished = true;
+        }
+
+        post([](stream_device *device) { device->notify(); });
+    }
+
+    void scheme_stream::impl::fail()
+    {
+        bool replied{false};
+
+        {
+            std::lock_guard guard{mutex};
+
+            if (done)
+            {
+                return;
+            }
+
+            replied = started;
+            done    = true;
+        }
+
+        if (!replied)
+        {
+            post([](stream_device *device) { device->fail(); });
+            return;
+        }
+
+        //? Once the reply started the response can only be cut short.
+
+        {
+            std::lock_guard guard{state->mutex};
+            state->finished = true;
+        }
+
+        post([](stream_device *device) { device->notify(); });
+    }
+
+    scheme_stream::scheme_stream(std::shared_ptr<impl> impl) : m_impl(std::move(impl)) {}
+
+    bool scheme_stream::start(std::string_view mime)
+    {
+        return m_impl->start(mime);
+    }
+
+    bool scheme_stream::write(std::string_view data)
+    {
+        return m_impl->write(data.data(), data.size());
+    }
+
+    bool scheme_stream::write(std::span<const std::uint8_t> data)
+    {
+        return m_impl->write(reinterpret_cast<const char *>(data.data()), data.size());
+    }
+
+    void scheme_stream::finish()
+    {
+        m_impl->finish();
+    }
+
+    void scheme_stream::fail()
+    {
+        m_impl->fail();
+    }
+
+    bool scheme_stream::cancelled() const
+    {
+        std::lock_guard guard{m_impl->state->mutex};
+        return !m_impl->state->device;
+    }
+} // namespace saucer
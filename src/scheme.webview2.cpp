@@ -0,0 +1,314 @@
+#include "scheme.webview2.impl.hpp"
+
+#include <cstring>
+#include <utility>
+#include <algorithm>
+
+namespace saucer
+{
+    //? Writers wait once this much data is buffered, so that a slow page does not make the buffer grow without bounds.
+    static constexpr auto high_water = 1024 * 1024;
+
+    void stream_reader::state::cancel()
+    {
+        {
+            std::lock_guard guard{mutex};
+            cancelled = true;
+        }
+
+        cv.notify_all();
+    }
+
+    stream_reader::stream_reader(std::shared_ptr<state> state) : m_state(std::move(state)) {}
+
+    stream_reader::~stream_reader()
+    {
+        //? The engine let go of the response, there is nobody left to read what the handler writes.
+        m_state->cancel();
+    }
+
+    HRESULT stream_reader::Read(void *data, ULONG size, ULONG *read)
+    {
+        std::unique_lock guard{m_state->mutex};
+
+        m_state->cv.wait(guard,
+                         [this]
+                         {
+                             return m_state->buffer.size() > m_state->offset || m_state->finished || m_state->failed ||
+                                    m_state->cancelled;
+                         });
+
+        if (read)
+        {
+            *read = 0;
+        }
+
+        if (m_state->failed || m_state->cancelled)
+        {
+            return E_FAIL;
+        }
+
+        auto &buffer    = m_state->buffer;
+        const auto left = buffer.size() - m_state->offset;
+
+        if (left == 0)
+        {
+            return S_FALSE;
+        }
+
+        const auto count = std::min<std::size_t>(size, left);
+
+        std::memcpy(data, buffer.data() + m_state->offset, count);
+        m_state->offset += count;
+
+        //? Consumed data is only dropped once it makes up half of the buffer, so that reads stay cheap.
+
+        if (m_state->offset * 2 >= buffer.size())
+        {
+            buffer.erase(0, m_state->offset);
+            m_state->offset = 0;
+        }
+
+        guard.unlock();
+        m_state->cv.notify_all();
+
+        m_position += count;
+
+        if (read)
+        {
+            *read = static_cast<ULONG>(count);
+        }
+
+        return S_OK;
+    }
+
+    HRESULT stream_reader::Write(const void *, ULONG, ULONG *)
+    {
+        return STG_E_ACCESSDENIED;
+    }
+
+    HRESULT stream_reader::Seek(LARGE_INTEGER move, DWORD origin, ULARGE_INTEGER *position)
+    {
+        //? The stream is sequential, it can only report where it currently is.
+
+        if (move.QuadPart != 0 || origin != STREAM_SEEK_CUR)
+        {
+            return STG_E_INVALIDFUNCTION;
+        }
+
+        if (position)
+        {
+            position->QuadPart = m_position;
+        }
+
+        return S_OK;
+    }
+
+    HRESULT stream_reader::SetSize(ULARGE_INTEGER)
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT stream_reader::CopyTo(IStream *, ULARGE_INTEGER, ULARGE_INTEGER *, ULARGE_INTEGER *)
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT stream_reader::Commit(DWORD)
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT stream_reader::Revert()
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT stream_reader::LockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD)
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT stream_reader::UnlockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD)
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT stream_reader::Stat(STATSTG *, DWORD)
+    {
+        return E_NOTIMPL;
+    }
+
+    HRESULT stream_reader::Clone(IStream **)
+    {
+        return E_NOTIMPL;
+    }
+
+    scheme_stream::impl::impl(respond_t respond)
+        : respond(std::move(respond)), state(std::make_shared<stream_reader::state>())
+    {
+    }
+
+    scheme_stream::impl::~impl()
+    {
+        //? The last copy of the stream completes the response, which makes returning from a handler enough.
+
+        if (started)
+        {
+            finish();
+            return;
+        }
+
+        fail();
+    }
+
+    void scheme_stream::impl::cancel()
+    {
+        {
+            std::lock_guard guard{mutex};
+            respond = nullptr;
+        }
+
+        state->cancel();
+    }
+
+    bool scheme_stream::impl::start(std::string_view mime)
+    {
+        std::lock_guard guard{mutex};
+
+        if (started || done || !respond)
+        {
+            return false;
+        }
+
+        started = true;
+
+        //? The lock is held while posting, so that the webview can not be destroyed in between, see `~webview`.
+        std::exchange(respond, nullptr)(std::string{mime}, Microsoft::WRL::Make<stream_reader>(state));
+
+        return true;
+    }
+
+    bool scheme_stream::impl::write(const char *data, std::size_t size)
+    {
+        {
+            std::lock_guard guard{mutex};
+
+            if (!started || done)
+            {
+                return false;
+            }
+        }
+
+        {
+            std::unique_lock guard{state->mutex};
+
+            state->cv.wait(guard,
+                           [this] { return state->cancelled || state->buffer.size() - state->offset < high_water; });
+
+            if (state->cancelled)
+            {
+                return false;
+            }
+
+            state->buffer.append(data, size);
+        }
+
+        state->cv.notify_all();
+
+        return true;
+    }
+
+    void scheme_stream::impl::finish()
+    {
+        {
+            std::lock_guard guard{mutex};
+
+            if (done)
+            {
+                return;
+            }
+
+            done = true;
+
+            if (!started && respond)
+            {
+                started = true;
+                std::exchange(respond, nullptr)("application/octet-stream", Microsoft::WRL::Make<stream_reader>(state));
+            }
+        }
+
+        {
+            std::lock_guard guard{state->mutex};
+            state->finished = true;
+        }
+
+        state->cv.notify_all();
+    }
+
+    void scheme_stream::impl::fail()
+    {
+        {
+            std::lock_guard guard{mutex};
+
+            if (done)
+            {
+                return;
+            }
+
+            done = true;
+
+            //? A response that was not started yet is answered with an error, a started one aborts its body.
+
+            if (!started)
+            {
+                if (respond)
+                {
+                    std::exchange(respond, nullptr)(std::nullopt, nullptr);
+                }
+
+                return;
+            }
+        }
+
+        {
+            std::lock_guard guard{state->mutex};
+            state->failed = true;
+        }
+
+        state->cv.notify_all();
+    }
+
+    scheme_stream::scheme_stream(std::shared_ptr<impl> impl) : m_impl(std::move(impl)) {}
+
+    bool scheme_stream::start(std::string_view mime)
+    {
+        return m_impl->start(mime);
+    }
+
+    bool scheme_stream::write(std::string_view data)
+    {
+        return m_impl->write(data.data(), data.size());
+    }
+
+    bool scheme_stream::write(std::span<const std::uint8_t> data)
+    {
+        return m_impl->write(reinterpret_cast<const char *>(data.data()), data.size());
+    }
+
+    void scheme_stream::finish()
+    {
+        m_impl->finish();
+    }
+
+    void scheme_stream::fail()
+    {
+        m_impl->fail();
+    }
+
+    bool scheme_stream::cancelled() const
+    {
+        std::lock_guard guard{m_impl->state->mutex};
+        return m_impl->state->cancelled;
+    }
+} // namespace saucer
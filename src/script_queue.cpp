@@ -0,0 +1,92 @@
+#include "script_queue.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+namespace saucer
+{
+    script_queue::script_queue(std::size_t limit) : m_limit(limit) {}
+
+    void script_queue::trim()
+    {
+        auto it = m_scripts.begin();
+
+        while (m_user > m_limit)
+        {
+            it = std::find_if(it, m_scripts.end(), [](const auto &entry) { return !entry.internal; });
+
+            m_bytes -= it->script.size();
+            it = m_scripts.erase(it);
+
+            m_user--;
+            m_dropped++;
+        }
+    }
+
+    void script_queue::push(std::string script, bool internal)
+    {
+        m_bytes += script.size();
+        m_user += internal ? 0 : 1;
+
+        m_scripts.emplace_back(entry{std::move(script), internal});
+
+        trim();
+    }
+
+    void script_queue::set_limit(std::size_t limit)
+    {
+        m_limit = std::max<std::size_t>(limit, 1);
+        trim();
+    }
+
+    bool script_queue::empty() const
+    {
+        return m_scripts.empty();
+    }
+
+    pending_stats script_queue::stats() const
+    {
+        return {.scripts = m_scripts.size(), .bytes = m_bytes, .dropped = m_dropped};
+    }
+
+    std::vector<std::string> script_queue::flush()
+    {
+        static constexpr std::string_view prefix = "try {\n";
+        static constexpr std::string_view suffix = "\n} catch (error) { console.error(error); }\n";
+
+        std::vector<std::string> rtn;
+        bool batching{false};
+
+        //? Consecutive internal scripts are merged into one batch, user scripts are kept as they are.
+
+        for (auto &entry : m_scripts)
+        {
+            if (!entry.internal)
+            {
+                rtn.emplace_back(std::move(entry.script));
+                batching = false;
+                continue;
+            }
+
+            if (!batching)
+            {
+                rtn.emplace_back();
+                batching = true;
+            }
+
+            auto &batch = rtn.back();
+
+            batch.reserve(batch.size() + prefix.size() + entry.script.size() + suffix.size());
+            batch += prefix;
+            batch += entry.script;
+            batch += suffix;
+        }
+
+        m_scripts.clear();
+
+        m_bytes = 0;
+        m_user  = 0;
+
+        return rtn;
+    }
+} // namespace saucer
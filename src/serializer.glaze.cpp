@@ -2,14 +2,38 @@
 
 #include <tl/expected.hpp>
 
+namespace saucer::serializers
+{
+    struct glaze_indexed_call
+    {
+        std::uint64_t id;
+        std::size_t function;
+        glz::raw_json params;
+        std::optional<saucer::priority> priority;
+    };
+} // namespace saucer::serializers
+
+template <>
+struct glz::meta<saucer::serializers::glaze_indexed_call>
+{
+    using T                     = saucer::serializers::glaze_indexed_call;
+    static constexpr auto value = object(  //
+        "id", &T::id,                       //
+        "function", &T::function,           //
+        "params", glz::escaped<&T::params>, //
+        "priority", &T::priority            //
+    );
+};
+
 template <>
 struct glz::meta<saucer::serializers::glaze_function_data>
 {
     using T                     = saucer::serializers::glaze_function_data;
     static constexpr auto value = object(  //
-        "id", &T::id,                      //
-        "name", &T::name,                  //
-        "params", glz::escaped<&T::params> //
+        "id", &T::id,                       //
+        "name", &T::name,                   //
+        "params", glz::escaped<&T::params>, //
+        "priority", &T::priority            //
     );
 };
 
@@ -37,6 +61,11 @@ namespace saucer::serializers
         return "JSON.stringify";
     }
 
+    std::string glaze::js_deserializer() const
+    {
+        return "JSON.parse";
+    }
+
     template <typename T>
     tl::expected<T, glz::error_ctx> parse_as(const std::string &buffer)
     {
@@ -55,6 +84,18 @@ namespace saucer::serializers
 
     std::unique_ptr<message_data> glaze::parse(const std::string &data) const
     {
+        if (auto res = parse_as<glaze_indexed_call>(data); res.has_value())
+        {
+            auto rtn = std::make_unique<glaze_function_data>();
+
+            rtn->id       = res->id;
+            rtn->index    = res->function;
+            rtn->params   = std::move(res->params);
+            rtn->priority = res->priority;
+
+            return rtn;
+        }
+
         if (auto res = parse_as<glaze_function_data>(data); res.has_value())
         {
             return std::make_unique<glaze_function_data>(res.value());
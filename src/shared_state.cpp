@@ -0,0 +1,319 @@
+#include "utils/shared_state.hpp"
+
+#include <ranges>
+#include <variant>
+#include <charconv>
+#include <algorithm>
+
+#include <fmt/format.h>
+
+namespace saucer::detail::state
+{
+    struct operation
+    {
+        std::string op;
+        std::string path;
+        glz::raw_json value;
+    };
+} // namespace saucer::detail::state
+
+template <>
+struct glz::meta<saucer::detail::state::operation>
+{
+    using T                     = saucer::detail::state::operation;
+    static constexpr auto value = object( //
+        "op", &T::op,                     //
+        "path", &T::path,                 //
+        "value", &T::value                //
+    );
+};
+
+namespace saucer::detail::state
+{
+    using object_t = glz::json_t::object_t;
+    using array_t  = glz::json_t::array_t;
+
+    std::string escape(std::string_view token)
+    {
+        std::string rtn;
+        rtn.reserve(token.size());
+
+        for (const auto &c : token)
+        {
+            if (c == '~')
+            {
+                rtn += "~0";
+                continue;
+            }
+
+            if (c == '/')
+            {
+                rtn += "~1";
+                continue;
+            }
+
+            rtn += c;
+        }
+
+        return rtn;
+    }
+
+    std::string unescape(std::string_view token)
+    {
+        std::string rtn;
+        rtn.reserve(token.size());
+
+        for (auto i = 0u; token.size() > i; i++)
+        {
+            if (token[i] != '~' || i + 1 >= token.size())
+            {
+                rtn += token[i];
+                continue;
+            }
+
+            rtn += token[++i] == '1' ? '/' : '~';
+        }
+
+        return rtn;
+    }
+
+    std::string make_operation(std::string_view op, const std::string &path, const glz::json_t *value = nullptr)
+    {
+        auto escaped = glz::write<opts>(path).value_or("\"\"");
+
+        if (!value)
+        {
+            return fmt::format(R"({{"op":"{}","path":{}}})", op, escaped);
+        }
+
+        return fmt::format(R"({{"op":"{}","path":{},"value":{}}})", op, escaped,
+                           glz::write<opts>(*value).value_or("null"));
+    }
+
+    bool equal(const glz::json_t &a, const glz::json_t &b)
+    {
+        //? Only used for values that are not both objects or both arrays, the scalars are compared as they are.
+
+        if (a.data.index() != b.data.index())
+        {
+            return false;
+        }
+
+        return std::visit(
+            [&]<typename V>(const V &value)
+            {
+                if constexpr (std::is_same_v<V, object_t> || std::is_same_v<V, array_t>)
+                {
+                    return false;
+                }
+                else
+                {
+                    return value == std::get<V>(b.data);
+                }
+            },
+            a.data);
+    }
+
+    void diff(const glz::json_t &from, const glz::json_t &to, const std::string &path, std::vector<std::string> &ops)
+    {
+        const auto *from_object = std::get_if<object_t>(&from.data);
+        const auto *to_object   = std::get_if<object_t>(&to.data);
+
+        if (from_object && to_object)
+        {
+            for (const auto &[key, _] : *from_object)
+            {
+                if (to_object->contains(key))
+                {
+                    continue;
+                }
+
+                ops.emplace_back(make_operation("remove", fmt::format("{}/{}", path, escape(key))));
+            }
+
+            for (const auto &[key, value] : *to_object)
+            {
+                auto current = fmt::format("{}/{}", path, escape(key));
+
+                if (auto it = from_object->find(key); it != from_object->end())
+                {
+                    diff(it->second, value, current, ops);
+                    continue;
+                }
+
+                ops.emplace_back(make_operation("add", current, &value));
+            }
+
+            return;
+        }
+
+        const auto *from_array = std::get_if<array_t>(&from.data);
+        const auto *to_array   = std::get_if<array_t>(&to.data);
+
+        if (from_array && to_array)
+        {
+            const auto common = std::min(from_array->size(), to_array->size());
+
+            for (auto i = 0u; common > i; i++)
+            {
+                diff(from_array->at(i), to_array->at(i), fmt::format("{}/{}", path, i), ops);
+            }
+
+            for (auto i = common; to_array->size() > i; i++)
+            {
+                ops.emplace_back(make_operation("add", fmt::format("{}/{}", path, i), &to_array->at(i)));
+            }
+
+            for (auto i = from_array->size(); i > common; i--)
+            {
+                ops.emplace_back(make_operation("remove", fmt::format("{}/{}", path, i - 1)));
+            }
+
+            return;
+        }
+
+        if (equal(from, to))
+        {
+            return;
+        }
+
+        ops.emplace_back(make_operation("replace", path, &to));
+    }
+
+    bool apply(glz::json_t &document, const operation &operation)
+    {
+        glz::json_t value{};
+
+        if (operation.op != "remove" && glz::read<opts>(value, operation.value.str))
+        {
+            return false;
+        }
+
+        if (operation.path.empty())
+        {
+            if (operation.op == "remove")
+            {
+                return false;
+            }
+
+            document = std::move(value);
+            return true;
+        }
+
+        if (!operation.path.starts_with('/'))
+        {
+            return false;
+        }
+
+        std::vector<std::string> tokens;
+        std::string_view path{operation.path};
+
+        for (std::size_t start = 1, end = 0; start <= path.size(); start = end + 1)
+        {
+            end = std::min(path.find('/', start), path.size());
+            tokens.emplace_back(unescape(path.substr(start, end - start)));
+        }
+
+        auto key            = std::move(tokens.back());
+        glz::json_t *parent = &document;
+
+        tokens.pop_back();
+
+        for (const auto &token : tokens)
+        {
+            if (auto *object = std::get_if<object_t>(&parent->data); object && object->contains(token))
+            {
+                parent = &object->at(token);
+                continue;
+            }
+
+            auto *array = std::get_if<array_t>(&parent->data);
+            auto index  = std::size_t{};
+
+            if (!array || std::from_chars(token.data(), token.data() + token.size(), index).ec != std::errc{} ||
+                index >= array->size())
+            {
+                return false;
+            }
+
+            parent = &array->at(index);
+        }
+
+        if (auto *object = std::get_if<object_t>(&parent->data); object)
+        {
+            if (operation.op == "add")
+            {
+                object->insert_or_assign(key, std::move(value));
+                return true;
+            }
+
+            auto it = object->find(key);
+
+            if (it == object->end())
+            {
+                return false;
+            }
+
+            if (operation.op == "remove")
+            {
+                object->erase(it);
+                return true;
+            }
+
+            it->second = std::move(value);
+            return operation.op == "replace";
+        }
+
+        auto *array = std::get_if<array_t>(&parent->data);
+
+        if (!array)
+        {
+            return false;
+        }
+
+        auto index = array->size();
+
+        if (key != "-" && std::from_chars(key.data(), key.data() + key.size(), index).ec != std::errc{})
+        {
+            return false;
+        }
+
+        if (operation.op == "add" && array->size() >= index)
+        {
+            array->insert(array->begin() + static_cast<std::ptrdiff_t>(index), std::move(value));
+            return true;
+        }
+
+        if (index >= array->size())
+        {
+            return false;
+        }
+
+        if (operation.op == "remove")
+        {
+            array->erase(array->begin() + static_cast<std::ptrdiff_t>(index));
+            return true;
+        }
+
+        array->at(index) = std::move(value);
+        return operation.op == "replace";
+    }
+
+    bool apply(glz::json_t &document, const std::string &patch)
+    {
+        std::vector<operation> operations;
+
+        if (glz::read<glz::opts{}>(operations, patch))
+        {
+            return false;
+        }
+
+        return std::ranges::all_of(operations, [&](const auto &operation) { return apply(document, operation); });
+    }
+
+    std::string script(const std::string &name, std::uint64_t version, const std::vector<std::string> &operations)
+    {
+        auto escaped = glz::write<opts>(name).value_or("\"\"");
+        return fmt::format("window.saucer._state_patch({}, {}, [{}]);", escaped, version, fmt::join(operations, ","));
+    }
+} // namespace saucer::detail::state
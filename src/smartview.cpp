@@ -1,230 +1,1835 @@
 #include "smartview.hpp"
+#include "gate.hpp"
+#include "timer.hpp"
+#include "executor.hpp"
+#include "slot_map.hpp"
+
+#include "utils/exceptions.hpp"
 
 #include "serializers/data.hpp"
 #include "serializers/serializer.hpp"
+#include "serializers/errors/overloaded.hpp"
 #include "serializers/errors/bad_function.hpp"
 
-#include <regex>
+#include <set>
+#include <mutex>
+#include <algorithm>
+#include <stop_token>
+#include <shared_mutex>
+#include <condition_variable>
+#include <vector>
+#include <array>
+#include <limits>
+#include <charconv>
+#include <optional>
+
 #include <fmt/core.h>
+#include <fmt/format.h>
 
 namespace saucer
 {
     using lockpp::lock;
 
+    namespace
+    {
+        //? Returns the given string as a JavaScript string literal.
+        std::string quote(std::string_view code)
+        {
+            static constexpr std::string_view line_separator      = "\xE2\x80\xA8";
+            static constexpr std::string_view paragraph_separator = "\xE2\x80\xA9";
+
+            std::string rtn{'"'};
+            rtn.reserve(code.size() + 2);
+
+            for (auto i = 0u; code.size() > i; i++)
+            {
+                const auto current = static_cast<unsigned char>(code[i]);
+
+                //? U+2028 and U+2029 are not allowed inside of string literals in older engines.
+
+                if (code.substr(i, 3) == line_separator || code.substr(i, 3) == paragraph_separator)
+                {
+                    rtn += code.substr(i, 3) == line_separator ? "\\u2028" : "\\u2029";
+                    i += 2;
+                    continue;
+                }
+
+                if (current == '"' || current == '\\')
+                {
+                    rtn += '\\';
+                    rtn += code[i];
+                    continue;
+                }
+
+                if (current < 0x20)
+                {
+                    rtn += fmt::format("\\u{:04x}", current);
+                    continue;
+                }
+
+                rtn += code[i];
+            }
+
+            rtn += '"';
+
+            return rtn;
+        }
+    } // namespace
+
     struct exposed_function
     {
-        bool async;
+        std::string name;
+        std::shared_ptr<gate> limiter;
+
+      public:
+        std::shared_ptr<executor::strand> strand;
         serializer::function function;
+        priority priority;
+    };
+
+    struct shared_object
+    {
+        std::shared_ptr<void> instance;
+        std::map<std::string, serializer::function> members;
+
+      public:
+        //? Objects shared while no document is loaded are meant for the upcoming one and outlive its navigation.
+        bool bound;
+    };
+
+    struct evaluation
+    {
+        serializer::resolver resolve;
+        std::function<void(std::exception_ptr)> reject;
+
+      public:
+        std::optional<std::uint64_t> deadline;
+
+      public:
+        //? Evaluations sent while no document is loaded are queued for the upcoming one and outlive its navigation.
+        bool delivered;
+    };
+
+    struct channel_data
+    {
+        bool in_flight{false};
+        std::set<std::string> dirty;
+        std::map<std::string, std::string> latest;
     };
 
     struct smartview_core::impl
     {
-        using id             = std::uint64_t;
-        using pending_future = std::shared_ptr<std::future<void>>;
+        using id = std::uint64_t;
+
+      public:
+        std::once_flag started;
+        std::unique_ptr<executor> pool;
+        std::shared_ptr<executor::strand> shared;
+
+      public:
+        gate global;
+        std::atomic_bool loaded{false};
+        std::atomic_uint64_t generation{0};
+
+      public:
+        std::mutex idle_mutex;
+        std::condition_variable idle;
+        slot_map<std::string> running;
+
+      public:
+        std::atomic_bool closing{false};
+        std::stop_source stop;
+
+      public:
+        bool abandoned{false};
+        std::shared_mutex lifetime;
+
+      public:
+        std::atomic<std::chrono::milliseconds::rep> shutdown_timeout{5000};
+        lock<std::function<void(const std::vector<std::string> &)>> on_abandon;
+        lock<std::map<std::string, std::shared_ptr<executor::strand>, std::less<>>> queues;
+
+      public:
+        lock<std::vector<std::shared_ptr<exposed_function>>> functions;
+        lock<std::map<std::string, std::size_t, std::less<>>> names;
+        slot_map<evaluation> evaluations;
+
+      public:
+        std::shared_ptr<void> alive{std::make_shared<bool>()};
+        lock<std::vector<std::string>> definitions;
+
+      public:
+        slot_map<std::function<void()>> attached;
+
+      public:
+        timer deadlines;
+        std::atomic<std::chrono::milliseconds::rep> evaluation_timeout{0};
+
+      public:
+        std::atomic_uint64_t timed_out{0};
+        std::atomic_uint64_t stale{0};
+
+      public:
+        lock<std::map<id, shared_object>> objects;
+
+      public:
+        //? Handles created while no document is loaded are meant for the upcoming one and outlive its navigation.
+        lock<std::map<id, bool>> handles;
 
       public:
-        lock<std::map<id, pending_future>> pending;
+        std::atomic_bool scheduled{false};
+        lock<executor::lanes<std::string>> outgoing;
 
       public:
-        lock<std::map<std::string, exposed_function>> functions;
-        lock<std::map<id, saucer::serializer::resolver>> evaluations;
+        lock<channel_data> channels;
+        std::atomic<std::chrono::milliseconds::rep> publish_interval{0};
 
       public:
         std::unique_ptr<saucer::serializer> serializer;
+
+      public:
+        std::optional<std::string> flush_channels(bool acknowledged);
+        std::optional<std::string> flush_definitions();
+        std::optional<serializer::function> find_member(std::string_view name);
+        std::shared_ptr<exposed_function> find_function(std::optional<std::size_t> index, std::string_view name);
+
+      public:
+        std::shared_ptr<executor::strand> make_strand(const policy &policy);
+
+      public:
+        void finish(const std::shared_ptr<gate> &limiter);
+        void admit(const std::shared_ptr<gate> &limiter);
+        void retry(const std::shared_ptr<gate> &limiter);
+
+      public:
+        void loaded_document();
+        void navigated();
+
+      public:
+        id track(std::string name);
+        void untrack(id ticket);
+
+      public:
+        void drain(smartview_core *parent);
+        void schedule(smartview_core *parent);
+        void enqueue(std::string code, priority priority);
+
+      public:
+        static constexpr std::size_t chunk_size   = 64 * 1024;
+        static constexpr std::size_t large_script = 64 * 1024;
+
+      public:
+        static constexpr std::string_view object_prefix  = "saucer:object:";
+        static constexpr std::string_view release_prefix = "saucer:release:";
     };
 
-    smartview_core::smartview_core(std::unique_ptr<serializer> serializer, const options &options)
-        : webview(options), m_impl(std::make_unique<impl>())
+    std::optional<serializer::function> smartview_core::impl::find_member(std::string_view name)
     {
-        m_impl->serializer = std::move(serializer);
+        name.remove_prefix(object_prefix.size());
 
-        inject(std::regex_replace(R"js(
-        window.saucer._idc = 0;
-        window.saucer._rpc = [];
-        
-        window.saucer.call = async (name, params) =>
+        auto separator = name.find(':');
+        auto id        = impl::id{};
+
+        if (separator == std::string_view::npos ||
+            std::from_chars(name.data(), name.data() + separator, id).ec != std::errc{})
         {
-            if (!Array.isArray(params))
-            {
-                throw 'Bad Arguments, expected array';
-            }
+            return std::nullopt;
+        }
 
-            if (typeof name !== 'string' && !(name instanceof String))
+        auto locked = objects.read();
+        auto object = locked->find(id);
+
+        if (object == locked->end())
+        {
+            return std::nullopt;
+        }
+
+        auto member = object->second.members.find(std::string{name.substr(separator + 1)});
+
+        if (member == object->second.members.end())
+        {
+            return std::nullopt;
+        }
+
+        return member->second;
+    }
+
+    std::shared_ptr<exposed_function> smartview_core::impl::find_function(std::optional<std::size_t> index,
+                                                                           std::string_view name)
+    {
+        if (!index)
+        {
+            auto locked = names.read();
+            auto entry  = locked->find(name);
+
+            if (entry == locked->end())
             {
-                throw 'Bad Name, expected string';
+                return nullptr;
             }
 
-            const id = ++window.saucer._idc;
-            
-            const rtn = new Promise((resolve, reject) => {
-                window.saucer._rpc[id] = {
-                    reject,
-                    resolve,
-                };
-            });
+            index = entry->second;
+        }
 
-            await window.saucer.on_message(<serializer>({
-                    id,
-                    name,
-                    params,
-            }));
+        auto locked = functions.read();
 
-            return rtn;
+        if (*index >= locked->size())
+        {
+            return nullptr;
         }
 
-        window.saucer._resolve = async (id, value) =>
+        return locked->at(*index);
+    }
+
+    void smartview_core::impl::finish(const std::shared_ptr<gate> &limiter)
+    {
+        //? The global gate never queues calls, only the function gate may hand out a deferred call.
+
+        global.leave();
+
+        if (!limiter)
         {
-            await window.saucer.on_message(<serializer>({
-                    id,
-                    result: value === undefined ? null : value,
-            }));
+            return;
         }
-        )js",
-                                  std::regex{"<serializer>"}, m_impl->serializer->js_serializer()),
-               load_time::creation);
 
-        inject(m_impl->serializer->script(), load_time::creation);
+        if (auto next = limiter->leave(); next)
+        {
+            (*next)();
+            return;
+        }
+
+        retry(limiter);
     }
 
-    smartview_core::~smartview_core()
+    void smartview_core::impl::admit(const std::shared_ptr<gate> &limiter)
     {
-        auto finished = m_impl->pending.copy().empty();
-
-        while (!finished)
+        while (auto next = limiter->poll())
         {
-            run<false>();
-            finished = m_impl->pending.copy().empty();
+            (*next)();
         }
+
+        retry(limiter);
     }
 
-    void smartview_core::call(function_data &data, const serializer::function &callback)
+    void smartview_core::impl::retry(const std::shared_ptr<gate> &limiter)
     {
-        auto result = callback(data);
+        //? Queued calls that are only waiting for the rate limit would otherwise wait for the next call to finish,
+        //? which may never happen.
 
-        if (result.has_value())
+        auto delay = limiter->retry();
+
+        if (!delay)
         {
-            resolve(data.id, *result);
             return;
         }
 
-        reject(data.id, std::move(result.error()));
+        deadlines.schedule(*delay, [this, limiter] { admit(limiter); });
     }
 
-    bool smartview_core::on_message(const std::string &message)
+    smartview_core::impl::id smartview_core::impl::track(std::string name)
     {
-        if (webview::on_message(message))
+        return running.insert(std::move(name));
+    }
+
+    void smartview_core::impl::untrack(id ticket)
+    {
+        running.take(ticket);
+
+        //? Notifying under the lock synchronizes with the waiting destructor, so that it can not miss the wake-up.
+
+        std::lock_guard guard{idle_mutex};
+        idle.notify_all();
+    }
+
+    void smartview_core::impl::loaded_document()
+    {
+        //? Everything that was queued while no document was loaded has now reached the current one.
+
+        loaded.store(true);
+
+        evaluations.for_each([](auto &evaluation) { evaluation.delivered = true; });
+
+        for (auto &[_, object] : *objects.write())
         {
-            return true;
+            object.bound = true;
         }
 
-        auto parsed = m_impl->serializer->parse(message);
+        for (auto &[_, bound] : *handles.write())
+        {
+            bound = true;
+        }
+    }
 
-        if (!parsed)
+    void smartview_core::impl::navigated()
+    {
+        //? Message ids are only unique per document, bumping the generation makes sure that calls which arrived from
+        //? the old document are neither started nor answered anymore.
+
+        loaded.store(false);
+        generation++;
+
+        for (auto &lane : *outgoing.write())
         {
-            return false;
+            lane.clear();
         }
 
-        if (auto *message = dynamic_cast<function_data *>(parsed.get()); message)
+        std::erase_if(*objects.write(), [](const auto &entry) { return entry.second.bound; });
+        std::erase_if(*handles.write(), [](const auto &entry) { return entry.second; });
+
+        for (auto &evaluation : evaluations.take_if([](const auto &evaluation) { return evaluation.delivered; }))
+        {
+            if (evaluation.deadline)
+            {
+                deadlines.cancel(*evaluation.deadline);
+            }
+
+            evaluation.reject(std::make_exception_ptr(exceptions::navigation{}));
+        }
+    }
+
+    void smartview_core::impl::drain(smartview_core *parent)
+    {
+        scheduled.store(false);
+
+        while (true)
         {
-            auto functions = m_impl->functions.copy();
+            auto script = pop(*outgoing.write());
 
-            if (!functions.contains(message->name))
+            if (!script)
             {
-                reject(message->id, std::make_unique<errors::bad_function>(message->name));
-                return false;
+                break;
             }
 
-            const auto &[async, callback] = functions.at(message->name);
+            parent->execute_internal(*script);
+
+            //? After a large script the remaining ones wait for the next iteration of the event loop, so that calls
+            //? from the page and scripts enqueued in higher lanes meanwhile are served first.
 
-            if (!async)
+            if (script->size() > large_script)
             {
-                call(*message, callback);
-                return true;
+                schedule(parent);
+                break;
             }
+        }
+    }
 
-            auto id     = m_id_counter++;
-            auto future = std::make_shared<impl::pending_future::element_type>();
+    void smartview_core::impl::schedule(smartview_core *parent)
+    {
+        //? Scripts are not sent by the thread that enqueues them but on the next iteration of the event loop, by then
+        //? everything enqueued in the meantime is ordered by its lane and higher priorities overtake lower ones.
 
-            auto locked = m_impl->pending.write();
-            locked->emplace(id, future);
+        if (scheduled.exchange(true))
+        {
+            return;
+        }
 
-            auto fn = [this, future, id, callback, parsed = std::move(parsed)]()
+        parent->dispatch(
+            [this, parent, alive = std::weak_ptr{this->alive}]
             {
-                auto *message = static_cast<function_data *>(parsed.get());
+                if (alive.expired())
+                {
+                    return;
+                }
 
-                call(*message, callback);
+                drain(parent);
+            });
+    }
 
-                auto locked = m_impl->pending.write();
-                locked->erase(id);
-            };
+    void smartview_core::impl::enqueue(std::string code, priority priority)
+    {
+        auto locked = outgoing.write();
+        (*locked)[static_cast<std::size_t>(priority)].emplace_back(std::move(code));
+    }
 
-            *future = std::async(std::launch::async, std::move(fn));
-            return true;
+    std::shared_ptr<executor::strand> smartview_core::impl::make_strand(const policy &policy)
+    {
+        if (std::holds_alternative<policies::ui>(policy))
+        {
+            return nullptr;
         }
 
-        if (auto *message = dynamic_cast<result_data *>(parsed.get()); message)
+        //? Most smartviews only ever expose functions that run on the UI thread, the workers are thus only started
+        //? once the first function actually needs them.
+
+        std::call_once(started,
+                       [this]
+                       {
+                           pool   = std::make_unique<executor>(std::max(std::thread::hardware_concurrency(), 4u));
+                           shared = pool->make_strand(std::numeric_limits<std::size_t>::max());
+                       });
+
+        if (std::holds_alternative<policies::pool>(policy))
         {
-            auto evals = m_impl->evaluations.write();
+            return shared;
+        }
 
-            if (!evals->contains(message->id))
-            {
-                return false;
-            }
+        if (const auto *limited = std::get_if<policies::limited>(&policy); limited)
+        {
+            return pool->make_strand(std::max(limited->concurrency, std::size_t{1}));
+        }
 
-            const auto &resolve = evals->at(message->id);
-            resolve(*message);
+        const auto &name = std::get<policies::serial>(policy).queue;
+        auto locked      = queues.write();
 
-            evals->erase(message->id);
-            return true;
+        if (auto queue = locked->find(name); queue != locked->end())
+        {
+            return queue->second;
         }
 
-        return false;
+        return locked->emplace(name, pool->make_strand(1)).first->second;
     }
 
-    void smartview_core::add_function(std::string name, serializer::function &&resolve, bool async)
+    std::optional<std::string> smartview_core::impl::flush_channels(bool acknowledged)
     {
-        auto functions = m_impl->functions.write();
-        functions->emplace(std::move(name), exposed_function{async, std::move(resolve)});
+        auto locked = channels.write();
+
+        if (locked->in_flight && !acknowledged)
+        {
+            return std::nullopt;
+        }
+
+        if (locked->dirty.empty())
+        {
+            locked->in_flight = false;
+            return std::nullopt;
+        }
+
+        std::vector<std::string> entries;
+        entries.reserve(locked->dirty.size());
+
+        for (const auto &channel : locked->dirty)
+        {
+            entries.emplace_back(locked->latest.at(channel));
+        }
+
+        locked->dirty.clear();
+        locked->in_flight = true;
+
+        return fmt::format("window.saucer._publish([{}], {});", fmt::join(entries, ", "), publish_interval.load());
     }
 
-    void smartview_core::add_evaluation(serializer::resolver &&resolve, const std::string &code)
+    std::optional<std::string> smartview_core::impl::flush_definitions()
     {
-        auto id = m_id_counter++;
+        auto pending = std::exchange(*definitions.write(), {});
 
+        if (pending.empty())
         {
-            auto locked = m_impl->evaluations.write();
-            locked->emplace(id, std::move(resolve));
+            return std::nullopt;
         }
 
-        execute(fmt::format(
-            R"(
-                (async () =>
-                    window.saucer._resolve({}, {})
-                )();
-            )",
-            id, code));
+        return fmt::format("{}", fmt::join(pending, "\n"));
     }
 
-    void smartview_core::reject(std::uint64_t id, serializer::error error)
+    constexpr std::size_t count_markers(std::string_view script, std::string_view marker)
     {
-        auto what = error->what();
-        std::replace(what.begin(), what.end(), '"', '\'');
+        std::size_t rtn{0};
 
-        execute(fmt::format(
-            R"(
-                window.saucer._rpc[{0}].reject("{1}");
-                delete window.saucer._rpc[{0}];
-            )",
-            id, what));
+        for (auto pos = script.find(marker); pos != std::string_view::npos; pos = script.find(marker, pos + 1))
+        {
+            rtn++;
+        }
+
+        return rtn;
     }
 
-    void smartview_core::resolve(std::uint64_t id, const std::string &result)
+    template <std::size_t N>
+    constexpr std::array<std::string_view, N + 1> split_script(std::string_view script, std::string_view marker)
     {
-        execute(fmt::format(
-            R"(
-                window.saucer._rpc[{0}].resolve({1});
-                delete window.saucer._rpc[{0}];
-            )",
-            id, result));
+        std::array<std::string_view, N + 1> rtn{};
+
+        for (auto i = 0u; N > i; i++)
+        {
+            const auto pos = script.find(marker);
+
+            rtn[i] = script.substr(0, pos);
+            script.remove_prefix(pos + marker.size());
+        }
+
+        rtn[N] = script;
+
+        return rtn;
+    }
+
+    smartview_core::smartview_core(std::unique_ptr<serializer> serializer, const options &options)
+        : webview(options), m_impl(std::make_shared<impl>())
+    {
+        m_impl->serializer = std::move(serializer);
+
+        static constexpr std::string_view bridge = R"js(
+        window.saucer._idc = 0;
+        window.saucer._rpc = [];
+        
+        window.saucer._priorities = ['low', 'normal', 'high'];
+
+        window.saucer._send = async (payload) =>
+        {
+            if (payload.priority !== undefined && !window.saucer._priorities.includes(payload.priority))
+            {
+                throw `Bad Priority, expected one of ${window.saucer._priorities.join(', ')}`;
+            }
+
+            const id = ++window.saucer._idc;
+            
+            const rtn = new Promise((resolve, reject) => {
+                window.saucer._rpc[id] = {
+                    reject,
+                    resolve,
+                };
+            });
+
+            await window.saucer.on_message(<serializer>({
+                    id,
+                    ...payload,
+            }));
+
+            return rtn;
+        }
+
+        window.saucer.call = async (name, params, { priority } = {}) =>
+        {
+            if (!Array.isArray(params))
+            {
+                throw 'Bad Arguments, expected array';
+            }
+
+            if (typeof name !== 'string' && !(name instanceof String))
+            {
+                throw 'Bad Name, expected string';
+            }
+
+            return window.saucer._send({ name, params, priority });
+        }
+
+        window.saucer.exposed = {};
+
+        window.saucer._expose = (index, name, arity) =>
+        {
+            const stub = (priority) => async (...params) =>
+            {
+                if (params.length !== arity)
+                {
+                    throw `Bad Arguments, expected ${arity} but got ${params.length}`;
+                }
+
+                return window.saucer._send({ function: index, params, priority });
+            };
+
+            window.saucer.exposed[name]      = stub(undefined);
+            window.saucer.exposed[name].with = ({ priority } = {}) => stub(priority);
+        }
+
+        window.saucer._chunks = new Map();
+
+        window.saucer._chunk = (id, piece) =>
+        {
+            if (!window.saucer._chunks.has(id))
+            {
+                window.saucer._chunks.set(id, []);
+            }
+
+            window.saucer._chunks.get(id).push(piece);
+        }
+
+        window.saucer._assemble = (id) =>
+        {
+            const pieces = window.saucer._chunks.get(id) ?? [];
+            window.saucer._chunks.delete(id);
+
+            return pieces.join('');
+        }
+
+        window.saucer._discarded = new Set();
+
+        window.saucer._discard = (id) =>
+        {
+            //? Evaluations that never answer would keep their id here forever, the oldest ones are forgotten first. A
+            //? late result of a forgotten evaluation is still counted as stale by the smartview.
+
+            if (window.saucer._discarded.size >= 1024)
+            {
+                window.saucer._discarded.delete(window.saucer._discarded.values().next().value);
+            }
+
+            window.saucer._discarded.add(id);
+        }
+
+        window.saucer._resolve = async (id, value) =>
+        {
+            if (window.saucer._discarded.delete(id))
+            {
+                await window.saucer.on_message('saucer:stale');
+                return;
+            }
+
+            await window.saucer.on_message(<serializer>({
+                    id,
+                    result: value === undefined ? null : value,
+            }));
+        }
+
+        window.saucer._listeners = new Map();
+
+        window.saucer.on = (event, handler) =>
+        {
+            if (!window.saucer._listeners.has(event))
+            {
+                window.saucer._listeners.set(event, new Set());
+            }
+
+            window.saucer._listeners.get(event).add(handler);
+            return () => window.saucer.off(event, handler);
+        }
+
+        window.saucer.off = (event, handler) =>
+        {
+            window.saucer._listeners.get(event)?.delete(handler);
+        }
+
+        window.saucer._channels = new Map();
+
+        window.saucer._channel = (channel) =>
+        {
+            if (!window.saucer._channels.has(channel))
+            {
+                window.saucer._channels.set(channel, { listeners: new Set() });
+            }
+
+            return window.saucer._channels.get(channel);
+        }
+
+        window.saucer.subscribe = (channel, handler) =>
+        {
+            const entry = window.saucer._channel(channel);
+            entry.listeners.add(handler);
+
+            if ('value' in entry)
+            {
+                handler(entry.value);
+            }
+
+            return () => entry.listeners.delete(handler);
+        }
+
+        window.saucer._publish = (entries, interval) =>
+        {
+            let delivered = false;
+
+            const deliver = () =>
+            {
+                if (delivered)
+                {
+                    return;
+                }
+
+                delivered = true;
+
+                for (const [channel, value] of entries)
+                {
+                    const entry = window.saucer._channel(channel);
+                    entry.value = value;
+
+                    for (const listener of [...entry.listeners])
+                    {
+                        try
+                        {
+                            listener(value);
+                        }
+                        catch (error)
+                        {
+                            console.error(error);
+                        }
+                    }
+                }
+
+                const acknowledge = () => window.saucer.on_message('saucer:published');
+
+                if (interval > 0)
+                {
+                    setTimeout(acknowledge, interval);
+                    return;
+                }
+
+                acknowledge();
+            };
+
+            //? Hidden, minimized and background windows never get an animation frame, which would leave the channel
+            //? unacknowledged forever. The timeout covers pages that are hidden while a frame is still pending.
+
+            if (document.visibilityState !== 'visible')
+            {
+                setTimeout(deliver, 0);
+                return;
+            }
+
+            requestAnimationFrame(deliver);
+            setTimeout(deliver, 100);
+        }
+
+        window.saucer._pointer = (path) =>
+        {
+            return path.split('/').slice(1).map(token => token.replaceAll('~1', '/').replaceAll('~0', '~'));
+        }
+
+        window.saucer._patch = (root, ops) =>
+        {
+            for (const { op, path, value } of ops)
+            {
+                const tokens = window.saucer._pointer(path);
+
+                if (tokens.length === 0)
+                {
+                    root = value;
+                    continue;
+                }
+
+                const key    = tokens.pop();
+                const parent = tokens.reduce((current, token) => current[token], root);
+
+                if (Array.isArray(parent))
+                {
+                    const index = key === '-' ? parent.length : Number(key);
+
+                    if (op === 'add')
+                    {
+                        parent.splice(index, 0, value);
+                    }
+                    else if (op === 'remove')
+                    {
+                        parent.splice(index, 1);
+                    }
+                    else
+                    {
+                        parent[index] = value;
+                    }
+
+                    continue;
+                }
+
+                if (op === 'remove')
+                {
+                    delete parent[key];
+                    continue;
+                }
+
+                parent[key] = value;
+            }
+
+            return root;
+        }
+
+        window.saucer._diff = (from, to, path = '', ops = []) =>
+        {
+            const is_object = (value) => value !== null && typeof value === 'object' && !Array.isArray(value);
+
+            if (Array.isArray(from) && Array.isArray(to))
+            {
+                const common = Math.min(from.length, to.length);
+
+                for (let i = 0; common > i; i++)
+                {
+                    window.saucer._diff(from[i], to[i], `${path}/${i}`, ops);
+                }
+
+                for (let i = common; to.length > i; i++)
+                {
+                    ops.push({ op: 'add', path: `${path}/${i}`, value: to[i] });
+                }
+
+                for (let i = from.length; i > common; i--)
+                {
+                    ops.push({ op: 'remove', path: `${path}/${i - 1}` });
+                }
+
+                return ops;
+            }
+
+            if (is_object(from) && is_object(to))
+            {
+                const escape = (key) => key.replaceAll('~', '~0').replaceAll('/', '~1');
+
+                for (const key of Object.keys(from))
+                {
+                    if (!Object.hasOwn(to, key))
+                    {
+                        ops.push({ op: 'remove', path: `${path}/${escape(key)}` });
+                    }
+                }
+
+                for (const key of Object.keys(to))
+                {
+                    if (Object.hasOwn(from, key))
+                    {
+                        window.saucer._diff(from[key], to[key], `${path}/${escape(key)}`, ops);
+                        continue;
+                    }
+
+                    ops.push({ op: 'add', path: `${path}/${escape(key)}`, value: to[key] });
+                }
+
+                return ops;
+            }
+
+            if (JSON.stringify(from) !== JSON.stringify(to))
+            {
+                ops.push({ op: 'replace', path, value: to });
+            }
+
+            return ops;
+        }
+
+        window.saucer._states = new Map();
+
+        window.saucer.state = (name) =>
+        {
+            if (window.saucer._states.has(name))
+            {
+                return window.saucer._states.get(name).ready;
+            }
+
+            const state =
+            {
+                version: 0,
+                value: undefined,
+                syncing: false,
+                listeners: new Set(),
+
+                notify: () =>
+                {
+                    for (const listener of [...state.listeners])
+                    {
+                        listener(state.value);
+                    }
+                },
+
+                sync: async () =>
+                {
+                    state.syncing = true;
+
+                    try
+                    {
+                        const [version, value] = await window.saucer.call(`saucer:state:get:${name}`, []);
+
+                        state.version = version;
+                        state.value   = value;
+                    }
+                    finally
+                    {
+                        state.syncing = false;
+                    }
+
+                    state.notify();
+                },
+
+                receive: (version, ops) =>
+                {
+                    if (state.syncing || state.version >= version)
+                    {
+                        return;
+                    }
+
+                    if (version !== state.version + 1)
+                    {
+                        state.sync();
+                        return;
+                    }
+
+                    state.value   = window.saucer._patch(state.value, ops);
+                    state.version = version;
+
+                    state.notify();
+                },
+
+                subscribe: (handler) =>
+                {
+                    state.listeners.add(handler);
+                    return () => state.listeners.delete(handler);
+                },
+
+                update: async (mutator) =>
+                {
+                    const draft = structuredClone(state.value);
+                    const next  = mutator(draft) ?? draft;
+                    const ops   = window.saucer._diff(state.value, next);
+
+                    if (ops.length === 0)
+                    {
+                        return;
+                    }
+
+                    const version = await window.saucer.call(`saucer:state:patch:${name}`, [state.version, JSON.stringify(ops)]);
+
+                    if (version === null)
+                    {
+                        await state.sync();
+                        throw 'Conflicting state update';
+                    }
+
+                    if (state.version >= version)
+                    {
+                        return;
+                    }
+
+                    if (version !== state.version + 1)
+                    {
+                        await state.sync();
+                        return;
+                    }
+
+                    state.value   = window.saucer._patch(state.value, ops);
+                    state.version = version;
+
+                    state.notify();
+                },
+            };
+
+            state.ready = state.sync().then(() => state);
+            window.saucer._states.set(name, state);
+
+            return state.ready;
+        }
+
+        window.saucer._state_patch = (name, version, ops) =>
+        {
+            window.saucer._states.get(name)?.receive(version, ops);
+        }
+
+        window.saucer._functions = [];
+        window.saucer.functions  = {};
+
+        window.saucer._define = (id, name, fn) =>
+        {
+            window.saucer._functions[id] = fn;
+            window.saucer.functions[name] = fn;
+        }
+
+        window.saucer._handles = new Map();
+
+        window.saucer._handle = (id, value) =>
+        {
+            window.saucer._handles.set(id, value);
+            return id;
+        }
+
+        window.saucer._lookup = (id) =>
+        {
+            if (!window.saucer._handles.has(id))
+            {
+                throw `Unknown handle ${id}, was it released?`;
+            }
+
+            return window.saucer._handles.get(id);
+        }
+
+        window.saucer._remotes = new Map();
+        window.saucer._proxies = new Map();
+
+        window.saucer._registry = new FinalizationRegistry((id) =>
+        {
+            const count = window.saucer._proxies.get(id) - 1;
+
+            if (count > 0)
+            {
+                window.saucer._proxies.set(id, count);
+                return;
+            }
+
+            window.saucer._proxies.delete(id);
+            window.saucer._remotes.delete(id);
+
+            window.saucer.on_message(`saucer:release:${id}`);
+        });
+
+        window.saucer.remote = (id) =>
+        {
+            const existing = window.saucer._remotes.get(id)?.deref();
+
+            if (existing)
+            {
+                return existing;
+            }
+
+            const handler =
+            {
+                get: (_, member) =>
+                {
+                    if (typeof member !== 'string' || member === 'then')
+                    {
+                        return undefined;
+                    }
+
+                    const invoke = (...params) => window.saucer.call(`saucer:object:${id}:${member}`, params);
+                    invoke.then  = (resolve, reject) => invoke().then(resolve, reject);
+
+                    return invoke;
+                },
+            };
+
+            const proxy = new Proxy({}, handler);
+
+            //? A proxy may already be unreachable while its finalizer did not run yet, in which case a second proxy is
+            //? handed out. The object is only released once every proxy for it was collected.
+
+            window.saucer._remotes.set(id, new WeakRef(proxy));
+            window.saucer._proxies.set(id, (window.saucer._proxies.get(id) ?? 0) + 1);
+            window.saucer._registry.register(proxy, id);
+
+            return proxy;
+        }
+
+        window.saucer._emit = (event, args) =>
+        {
+            const listeners = window.saucer._listeners.get(event);
+
+            if (!listeners)
+            {
+                return;
+            }
+
+            for (const listener of [...listeners])
+            {
+                try
+                {
+                    listener(...args);
+                }
+                catch (error)
+                {
+                    console.error(error);
+                }
+            }
+        }
+        )js";
+
+        //? The bridge is split at compile time, so that filling in the serializer only takes a few appends. It is
+        //? injected together with the script of the serializer.
+
+        static constexpr std::string_view marker = "<serializer>";
+        static constexpr auto parts              = split_script<count_markers(bridge, marker)>(bridge, marker);
+
+        const auto name       = m_impl->serializer->js_serializer();
+        const auto definition = m_impl->serializer->script();
+
+        std::string script;
+        script.reserve(bridge.size() + (name.size() * (parts.size() - 1)) + definition.size() + 1);
+
+        for (auto i = 0u; parts.size() > i; i++)
+        {
+            if (i > 0)
+            {
+                script += name;
+            }
+
+            script += parts[i];
+        }
+
+        script += '\n';
+        script += definition;
+
+        inject(script, load_time::creation);
+
+        //? Any delivery that was in flight belongs to the old document, the new one receives the latest value of every
+        //? channel once it is ready. Evaluations that the old document did not answer fail, and the objects it shared
+        //? are released. Everything that was queued for the new document is left alone.
+
+        on<web_event::dom_ready>([this] { m_impl->loaded_document(); });
+
+        on<web_event::load_started>(
+            [this]
+            {
+                m_impl->navigated();
+
+                {
+                    auto locked       = m_impl->channels.write();
+                    locked->in_flight = false;
+
+                    for (const auto &[channel, _] : locked->latest)
+                    {
+                        locked->dirty.emplace(channel);
+                    }
+                }
+
+                if (auto script = m_impl->flush_channels(false); script)
+                {
+                    execute_internal(*script);
+                }
+            });
+
+        record(startup_phase::bridge);
+    }
+
+    smartview_core::~smartview_core()
+    {
+        using clock = std::chrono::steady_clock;
+
+        for (auto &on_destroy : m_impl->attached.take_all())
+        {
+            on_destroy();
+        }
+
+        //? From here on no new calls are accepted and nothing is sent to the page anymore. Handlers that are still
+        //? running are asked to stop through the stop token.
+
+        m_impl->alive.reset();
+        m_impl->closing.store(true);
+        m_impl->stop.request_stop();
+        m_impl->deadlines.stop();
+
+        for (auto &evaluation : m_impl->evaluations.take_all())
+        {
+            evaluation.reject(std::make_exception_ptr(exceptions::closed{}));
+        }
+
+        //? Calls that still wait in a backlog are let through, they notice the shutdown and finish right away.
+
+        for (const auto &function : m_impl->functions.copy())
+        {
+            if (!function)
+            {
+                continue;
+            }
+
+            for (auto &task : function->limiter->flush())
+            {
+                task();
+            }
+        }
+
+        //? Handlers may still need the UI thread, which is why the event loop keeps running in between waits.
+
+        static constexpr auto slice = std::chrono::milliseconds{10};
+
+        const auto timeout  = std::chrono::milliseconds{m_impl->shutdown_timeout.load()};
+        const auto deadline = clock::now() + timeout;
+
+        std::unique_lock guard{m_impl->idle_mutex};
+
+        while (m_impl->running.size() > 0 || !m_impl->deadlines.finished())
+        {
+            const auto now = clock::now();
+
+            if (now >= deadline)
+            {
+                break;
+            }
+
+            guard.unlock();
+            run<false>();
+            guard.lock();
+
+            m_impl->idle.wait_for(guard, std::min<clock::duration>(slice, deadline - now));
+        }
+
+        if (m_impl->running.size() == 0 && m_impl->deadlines.finished())
+        {
+            return;
+        }
+
+        std::vector<std::string> outstanding;
+        outstanding.reserve(m_impl->running.size());
+
+        m_impl->running.for_each([&](const auto &name) { outstanding.emplace_back(name); });
+
+        guard.unlock();
+
+        {
+            std::unique_lock lifetime{m_impl->lifetime};
+            m_impl->abandoned = true;
+        }
+
+        if (auto report = m_impl->on_abandon.copy(); report)
+        {
+            report(outstanding);
+        }
+
+        //? Queued calls were cancelled above and skip their handler once they start, the calls that are still running
+        //? keep their share of the impl. It is released by the last of them, the workers that are busy at that point
+        //? are detached instead of joined.
+    }
+
+    void smartview_core::call(function_data &data, const serializer::function &callback, priority priority,
+                              std::uint64_t generation)
+    {
+        if (generation != m_impl->generation.load())
+        {
+            return;
+        }
+
+        respond(data.id, callback(data), priority, generation);
+    }
+
+    void smartview_core::respond(std::uint64_t id, serializer::function::result_type result, priority priority,
+                                 std::uint64_t generation)
+    {
+        if (generation != m_impl->generation.load())
+        {
+            return;
+        }
+
+        if (result.has_value())
+        {
+            resolve(id, *result, priority);
+            record(startup_phase::first_call);
+            return;
+        }
+
+        reject(id, std::move(result.error()), priority);
+    }
+
+    bool smartview_core::on_message(const std::string &message)
+    {
+        if (webview::on_message(message))
+        {
+            return true;
+        }
+
+        if (m_impl->closing.load())
+        {
+            return false;
+        }
+
+        if (message == "saucer:stale")
+        {
+            m_impl->stale++;
+            return true;
+        }
+
+        if (message == "saucer:published")
+        {
+            if (auto script = m_impl->flush_channels(true); script)
+            {
+                execute_internal(*script);
+            }
+
+            return true;
+        }
+
+        if (message.starts_with(impl::release_prefix))
+        {
+            auto id     = impl::id{};
+            auto *begin = message.data() + impl::release_prefix.size();
+
+            if (std::from_chars(begin, message.data() + message.size(), id).ec != std::errc{})
+            {
+                return false;
+            }
+
+            release({id});
+            return true;
+        }
+
+        auto parsed = m_impl->serializer->parse(message);
+
+        if (!parsed)
+        {
+            return false;
+        }
+
+        if (auto *message = dynamic_cast<function_data *>(parsed.get()); message)
+        {
+            auto generation = m_impl->generation.load();
+
+            if (message->name.starts_with(impl::object_prefix))
+            {
+                auto member = m_impl->find_member(message->name);
+
+                if (!member)
+                {
+                    reject(message->id, std::make_unique<errors::bad_function>(message->name));
+                    return false;
+                }
+
+                if (m_impl->global.enter() == gate::verdict::rejected)
+                {
+                    reject(message->id, std::make_unique<errors::overloaded>(message->name));
+                    return false;
+                }
+
+                call(*message, *member, priority::normal, generation);
+                m_impl->finish(nullptr);
+
+                return true;
+            }
+
+            auto function = m_impl->find_function(message->index, message->name);
+
+            if (!function)
+            {
+                auto name = message->index ? fmt::format("#{}", *message->index) : message->name;
+                reject(message->id, std::make_unique<errors::bad_function>(std::move(name)));
+                return false;
+            }
+
+            const auto &[name, limiter, strand, callback, fallback] = *function;
+            auto priority                                           = message->priority.value_or(fallback);
+
+            //? Calls that exceed the global limits are rejected right away. Calls that exceed the limits of their
+            //? function may wait in its backlog, they keep their global slot while doing so which bounds the total
+            //? amount of waiting calls.
+
+            if (m_impl->global.enter() == gate::verdict::rejected)
+            {
+                reject(message->id, std::make_unique<errors::overloaded>(name), priority);
+                return false;
+            }
+
+            if (!strand)
+            {
+                if (limiter->enter() == gate::verdict::rejected)
+                {
+                    m_impl->global.leave();
+                    reject(message->id, std::make_unique<errors::overloaded>(name), priority);
+                    return false;
+                }
+
+                call(*message, callback, priority, generation);
+                m_impl->finish(limiter);
+
+                return true;
+            }
+
+            auto ticket = m_impl->track(name);
+
+            //? Should the smartview give up on this call during shutdown, it is destroyed while the call may still be
+            //? running. The call shares the impl, which then outlives the smartview until the last call is done, but
+            //? may only touch the smartview itself while holding its lifetime.
+
+            auto fn = [this, state = m_impl, ticket, function, parsed = std::shared_ptr{std::move(parsed)},
+                       priority, generation]()
+            {
+                auto *message = static_cast<function_data *>(parsed.get());
+
+                if (!state->closing.load() && generation == state->generation.load())
+                {
+                    auto result = function->function(*message);
+                    std::shared_lock guard{state->lifetime};
+
+                    if (!state->abandoned)
+                    {
+                        respond(message->id, std::move(result), priority, generation);
+                    }
+                }
+
+                state->finish(function->limiter);
+                state->untrack(ticket);
+            };
+
+            std::function<void()> deferred = [strand, fn = std::move(fn), priority]()
+            {
+                strand->post(fn, priority);
+            };
+
+            switch (limiter->enter(&deferred))
+            {
+            case gate::verdict::admitted:
+                deferred();
+                return true;
+            case gate::verdict::queued:
+                m_impl->retry(limiter);
+                return true;
+            case gate::verdict::rejected:
+                break;
+            }
+
+            m_impl->untrack(ticket);
+            m_impl->global.leave();
+
+            reject(message->id, std::make_unique<errors::overloaded>(name), priority);
+            return false;
+        }
+
+        if (auto *message = dynamic_cast<result_data *>(parsed.get()); message)
+        {
+            auto evaluation = m_impl->evaluations.take(message->id);
+
+            if (!evaluation)
+            {
+                m_impl->stale++;
+                return false;
+            }
+
+            if (evaluation->deadline)
+            {
+                m_impl->deadlines.cancel(*evaluation->deadline);
+            }
+
+            evaluation->resolve(*message);
+            return true;
+        }
+
+        return false;
+    }
+
+    std::optional<std::size_t> smartview_core::add_function(std::string name, serializer::function &&resolve,
+                                                            const policy &policy, priority priority)
+    {
+        auto names = m_impl->names.write();
+
+        if (names->contains(name))
+        {
+            return std::nullopt;
+        }
+
+        auto functions = m_impl->functions.write();
+        auto index     = functions->size();
+
+        functions->emplace_back(std::make_shared<exposed_function>(exposed_function{
+            name,
+            std::make_shared<gate>(),
+            m_impl->make_strand(policy),
+            std::move(resolve),
+            priority,
+        }));
+
+        names->emplace(std::move(name), index);
+
+        return index;
+    }
+
+    void smartview_core::add_evaluation(serializer::resolver &&resolve, std::function<void(std::exception_ptr)> &&reject,
+                                        const std::string &code, const evaluate_options &options)
+    {
+        using std::chrono::milliseconds;
+
+        if (m_impl->closing.load())
+        {
+            reject(std::make_exception_ptr(exceptions::closed{}));
+            return;
+        }
+
+        auto priority = options.priority;
+        auto timeout  = options.timeout.value_or(milliseconds{m_impl->evaluation_timeout.load()});
+        auto id       = m_impl->evaluations.insert({
+            std::move(resolve),
+            std::move(reject),
+            std::nullopt,
+            m_impl->loaded.load(),
+        });
+
+        //? The page is told to discard the result of an expired evaluation, so that a late answer is not serialized
+        //? and sent back for nothing. Like the calls, the deadline only relies on the impl and may only reach the
+        //? webview while holding its lifetime.
+
+        auto expire = [this, state = m_impl.get(), id]()
+        {
+            if (state->closing.load())
+            {
+                return;
+            }
+
+            auto expired = state->evaluations.take(id);
+
+            if (!expired)
+            {
+                return;
+            }
+
+            state->timed_out++;
+            expired->reject(std::make_exception_ptr(exceptions::timeout{}));
+
+            std::shared_lock guard{state->lifetime};
+
+            if (state->abandoned || state->closing.load())
+            {
+                return;
+            }
+
+            state->enqueue(fmt::format("window.saucer._discard({});", id), priority::high);
+            state->schedule(this);
+        };
+
+        //? The evaluation may already be answered or expired once the deadline is stored, in which case there is no
+        //? entry left to modify and the deadline simply runs out without effect.
+
+        if (timeout.count() > 0)
+        {
+            auto deadline = m_impl->deadlines.schedule(timeout, std::move(expire));
+            m_impl->evaluations.modify(id, [deadline](auto &entry) { entry.deadline = deadline; });
+        }
+
+        auto script = fmt::format(
+            R"(
+                (async () =>
+                    window.saucer._resolve({}, {})
+                )();
+            )",
+            id, code);
+
+        send(std::move(script), priority);
+    }
+
+    void smartview_core::add_definition(const std::string &definition)
+    {
+        //? Every injection rebuilds the creation script and every execution is a round-trip to the page, which is
+        //? why definitions are collected and flushed together on the next iteration of the event loop.
+
+        {
+            auto locked = m_impl->definitions.write();
+            locked->emplace_back(definition);
+
+            if (locked->size() > 1)
+            {
+                return;
+            }
+        }
+
+        dispatch(
+            [this, alive = std::weak_ptr{m_impl->alive}]
+            {
+                if (alive.expired())
+                {
+                    return;
+                }
+
+                flush_definitions();
+            });
+    }
+
+    void smartview_core::flush_definitions()
+    {
+        auto script = m_impl->flush_definitions();
+
+        if (!script)
+        {
+            return;
+        }
+
+        inject(*script, load_time::creation);
+        execute_internal(*script);
+    }
+
+    void smartview_core::add_publication(const std::string &channel, std::string value)
+    {
+        {
+            auto locked = m_impl->channels.write();
+
+            locked->dirty.emplace(channel);
+            locked->latest.insert_or_assign(channel, std::move(value));
+        }
+
+        flush_definitions();
+
+        if (auto script = m_impl->flush_channels(false); script)
+        {
+            execute_internal(*script);
+        }
+    }
+
+    void smartview_core::add_object(std::uint64_t id, std::shared_ptr<void> instance,
+                                    std::map<std::string, serializer::function> &&members)
+    {
+        auto locked = m_impl->objects.write();
+        locked->emplace(id, shared_object{std::move(instance), std::move(members), m_impl->loaded.load()});
+    }
+
+    void smartview_core::add_handle(std::uint64_t id)
+    {
+        auto locked = m_impl->handles.write();
+        locked->emplace(id, m_impl->loaded.load());
+    }
+
+    bool smartview_core::owns(const js_handle &handle) const
+    {
+        return m_impl->handles.read()->contains(handle.id);
+    }
+
+    void smartview_core::reject(std::uint64_t id, serializer::error error, priority priority)
+    {
+        auto what = error->what();
+        std::replace(what.begin(), what.end(), '"', '\'');
+
+        auto code = fmt::format(
+            R"(
+                window.saucer._rpc[{0}].reject("{1}");
+                delete window.saucer._rpc[{0}];
+            )",
+            id, what);
+
+        send(std::move(code), priority);
+    }
+
+    void smartview_core::resolve(std::uint64_t id, const std::string &result, priority priority)
+    {
+        const auto parse = m_impl->serializer->js_deserializer();
+
+        const auto resolve = [&](const std::string &data)
+        {
+            return fmt::format(
+                R"(
+                    window.saucer._rpc[{0}].resolve({1}({2}));
+                    delete window.saucer._rpc[{0}];
+                )",
+                id, parse, data);
+        };
+
+        if (priority != priority::low || impl::chunk_size >= result.size())
+        {
+            send(resolve(quote(result)), priority);
+            return;
+        }
+
+        //? Large low priority results are transferred piece by piece, so that scripts from higher lanes can be sent in
+        //? between. Only the serialized data is split, the page joins the pieces and parses them once complete, which
+        //? unlike evaluating code is not restricted by a content security policy. Pieces end on UTF-8 boundaries.
+
+        std::string_view remaining{result};
+
+        while (!remaining.empty())
+        {
+            auto size = std::min(impl::chunk_size, remaining.size());
+
+            while (remaining.size() > size && (static_cast<unsigned char>(remaining[size]) & 0xC0) == 0x80)
+            {
+                size--;
+            }
+
+            send(fmt::format("window.saucer._chunk({}, {});", id, quote(remaining.substr(0, size))), priority);
+            remaining.remove_prefix(size);
+        }
+
+        send(resolve(fmt::format("window.saucer._assemble({})", id)), priority);
+    }
+
+    void smartview_core::send(std::string code, priority priority)
+    {
+        if (m_impl->closing.load())
+        {
+            return;
+        }
+
+        flush_definitions();
+
+        m_impl->enqueue(std::move(code), priority);
+        m_impl->schedule(this);
+    }
+
+    void smartview_core::send_event(const serialized_event &event)
+    {
+        send(event.code, priority::normal);
+    }
+
+    bool smartview_core::release(const js_handle &handle)
+    {
+        if (!m_impl->handles.write()->erase(handle.id))
+        {
+            return false;
+        }
+
+        send(fmt::format("window.saucer._handles.delete({});", handle.id), priority::normal);
+
+        return true;
+    }
+
+    void smartview_core::release(const object_handle &handle)
+    {
+        auto locked = m_impl->objects.write();
+        locked->erase(handle.id);
+    }
+
+    bool smartview_core::unexpose(const std::string &name)
+    {
+        {
+            auto names = m_impl->names.write();
+            auto entry = names->find(name);
+
+            if (entry == names->end())
+            {
+                return false;
+            }
+
+            //? The slot is left empty instead of being erased, the indices of the other functions are already known to
+            //? the page.
+
+            m_impl->functions.write()->at(entry->second).reset();
+            names->erase(entry);
+        }
+
+        add_definition(fmt::format("delete window.saucer.exposed[{}];", quote(name)));
+
+        return true;
+    }
+
+    std::uint64_t smartview_core::attach(std::function<void()> on_destroy)
+    {
+        return m_impl->attached.insert(std::move(on_destroy));
+    }
+
+    void smartview_core::detach(std::uint64_t id)
+    {
+        m_impl->attached.take(id);
+    }
+
+    std::optional<execution_stats> smartview_core::statistics(const std::string &name) const
+    {
+        auto function = m_impl->find_function(std::nullopt, name);
+
+        if (!function || !function->strand)
+        {
+            return std::nullopt;
+        }
+
+        return function->strand->stats();
+    }
+
+    admission_stats smartview_core::admission() const
+    {
+        return m_impl->global.stats();
+    }
+
+    std::optional<admission_stats> smartview_core::admission(const std::string &name) const
+    {
+        auto function = m_impl->find_function(std::nullopt, name);
+
+        if (!function)
+        {
+            return std::nullopt;
+        }
+
+        return function->limiter->stats();
+    }
+
+    void smartview_core::set_limits(const limits &limits)
+    {
+        m_impl->global.configure(limits);
+    }
+
+    bool smartview_core::set_limits(const std::string &name, const limits &limits)
+    {
+        auto function = m_impl->find_function(std::nullopt, name);
+
+        if (!function)
+        {
+            return false;
+        }
+
+        function->limiter->configure(limits);
+        return true;
+    }
+
+    evaluation_stats smartview_core::evaluation_statistics() const
+    {
+        return {
+            .timed_out = m_impl->timed_out.load(),
+            .stale     = m_impl->stale.load(),
+        };
+    }
+
+    void smartview_core::set_evaluation_timeout(std::chrono::milliseconds timeout)
+    {
+        m_impl->evaluation_timeout.store(timeout.count());
+    }
+
+    std::stop_token smartview_core::stop_token() const
+    {
+        return m_impl->stop.get_token();
+    }
+
+    void smartview_core::set_shutdown_timeout(std::chrono::milliseconds timeout,
+                                              std::function<void(const std::vector<std::string> &)> on_abandon)
+    {
+        m_impl->shutdown_timeout.store(timeout.count());
+        *m_impl->on_abandon.write() = std::move(on_abandon);
+    }
+
+    void smartview_core::set_publish_interval(std::chrono::milliseconds interval)
+    {
+        m_impl->publish_interval.store(interval.count());
     }
 } // namespace saucer
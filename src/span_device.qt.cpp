@@ -0,0 +1,49 @@
+#include "span_device.qt.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace saucer
+{
+    span_device::span_device(std::span<const std::uint8_t> data, std::shared_ptr<const void> owner, QObject *parent)
+        : QIODevice(parent), m_data(data), m_owner(std::move(owner))
+    {
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
+
+    bool span_device::isSequential() const
+    {
+        return false;
+    }
+
+    qint64 span_device::size() const
+    {
+        return static_cast<qint64>(m_data.size());
+    }
+
+    qint64 span_device::bytesAvailable() const
+    {
+        return (size() - pos()) + QIODevice::bytesAvailable();
+    }
+
+    qint64 span_device::readData(char *data, qint64 max_size)
+    {
+        const auto offset = pos();
+
+        if (offset >= size())
+        {
+            return 0;
+        }
+
+        const auto count = std::min(max_size, size() - offset);
+        std::memcpy(data, m_data.data() + offset, static_cast<std::size_t>(count));
+
+        return count;
+    }
+
+    qint64 span_device::writeData(const char *, qint64)
+    {
+        return -1;
+    }
+} // namespace saucer
@@ -0,0 +1,49 @@
+#include "startup_recorder.hpp"
+
+namespace saucer
+{
+    startup_recorder::startup_recorder() : m_origin(clock::now()) {}
+
+    void startup_recorder::record(startup_phase phase)
+    {
+        const auto elapsed = std::chrono::duration_cast<startup_timings::duration>(clock::now() - m_origin);
+
+        std::lock_guard guard{m_mutex};
+        std::optional<startup_timings::duration> *target{};
+
+        switch (phase)
+        {
+        case startup_phase::application:
+            target = &m_timings.application;
+            break;
+        case startup_phase::window:
+            target = &m_timings.window;
+            break;
+        case startup_phase::engine:
+            target = &m_timings.engine;
+            break;
+        case startup_phase::bridge:
+            target = &m_timings.bridge;
+            break;
+        case startup_phase::dom_ready:
+            target = &m_timings.dom_ready;
+            break;
+        case startup_phase::first_call:
+            target = &m_timings.first_call;
+            break;
+        }
+
+        if (!target || target->has_value())
+        {
+            return;
+        }
+
+        *target = elapsed;
+    }
+
+    startup_timings startup_recorder::timings() const
+    {
+        std::lock_guard guard{m_mutex};
+        return m_timings;
+    }
+} // namespace saucer
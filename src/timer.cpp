@@ -0,0 +1,105 @@
+#include "timer.hpp"
+
+namespace saucer
+{
+    timer::~timer()
+    {
+        stop();
+
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+
+        m_thread.join();
+    }
+
+    void timer::work()
+    {
+        std::unique_lock guard{m_mutex};
+
+        while (!m_stop)
+        {
+            if (m_tasks.empty())
+            {
+                m_cv.wait(guard);
+                continue;
+            }
+
+            auto next = m_tasks.begin();
+
+            if (next->first.first > clock::now())
+            {
+                m_cv.wait_until(guard, next->first.first);
+                continue;
+            }
+
+            auto callback = std::move(next->second);
+
+            m_deadlines.erase(next->first.second);
+            m_tasks.erase(next);
+
+            guard.unlock();
+            callback();
+            guard.lock();
+        }
+
+        m_finished.store(true);
+    }
+
+    std::uint64_t timer::schedule(clock::duration delay, task callback)
+    {
+        std::lock_guard guard{m_mutex};
+
+        if (!m_thread.joinable() && !m_stop)
+        {
+            m_thread = std::thread{&timer::work, this};
+        }
+
+        auto id       = m_counter++;
+        auto deadline = clock::now() + delay;
+
+        m_tasks.emplace(key{deadline, id}, std::move(callback));
+        m_deadlines.emplace(id, deadline);
+
+        m_cv.notify_one();
+
+        return id;
+    }
+
+    void timer::cancel(std::uint64_t id)
+    {
+        std::lock_guard guard{m_mutex};
+
+        auto deadline = m_deadlines.find(id);
+
+        if (deadline == m_deadlines.end())
+        {
+            return;
+        }
+
+        m_tasks.erase(key{deadline->second, id});
+        m_deadlines.erase(deadline);
+    }
+
+    void timer::stop()
+    {
+        {
+            std::lock_guard guard{m_mutex};
+
+            m_stop = true;
+            m_tasks.clear();
+            m_deadlines.clear();
+        }
+
+        m_cv.notify_all();
+    }
+
+    bool timer::finished() const
+    {
+        //? The thread is started under the lock, reading it without would race with `schedule`.
+
+        std::lock_guard guard{m_mutex};
+        return m_finished.load() || !m_thread.joinable();
+    }
+} // namespace saucer
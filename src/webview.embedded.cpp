@@ -0,0 +1,48 @@
+#include "webview.hpp"
+
+namespace saucer
+{
+    std::optional<embedded_entry> webview::find_embedded(std::string_view path) const
+    {
+        //? Tables are consulted in the order they were embedded, the first match wins. This mirrors `embed` with a map,
+        //? which does not overwrite files that are already present.
+
+        for (const auto &table : m_embedded_tables)
+        {
+            if (const auto *entry = table.find(path); entry)
+            {
+                return *entry;
+            }
+        }
+
+        auto it = m_embedded_files.find(path);
+
+        if (it == m_embedded_files.end())
+        {
+            return std::nullopt;
+        }
+
+        return embedded_entry{it->first, it->second.mime, it->second.content};
+    }
+
+    std::shared_ptr<response_handler> webview::find_handler(std::string_view path) const
+    {
+        //? The longest matching prefix wins, so that "api/" can be overridden for "api/tiles/".
+
+        std::shared_ptr<response_handler> rtn;
+        std::size_t length{0};
+
+        for (const auto &[prefix, handler] : m_handlers)
+        {
+            if (!path.starts_with(prefix) || (rtn && prefix.size() < length))
+            {
+                continue;
+            }
+
+            rtn    = handler;
+            length = prefix.size();
+        }
+
+        return rtn;
+    }
+} // namespace saucer
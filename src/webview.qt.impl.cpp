@@ -1,63 +1,120 @@
+#include "span_device.qt.hpp"
+#include "scheme.qt.impl.hpp"
 #include "webview.qt.impl.hpp"
 
+#include <optional>
+#include <string_view>
+
 #include <QFile>
-#include <QBuffer>
+#include <QWebEngineScript>
+#include <QWebEngineProfile>
 #include <QWebEngineUrlRequestJob>
+#include <QWebEngineScriptCollection>
 
 namespace saucer
 {
-    const std::string webview::impl::ready_script = "window.saucer.on_message('dom_loaded')";
+    const std::string &webview::impl::inject_script()
+    {
+        static const auto rtn = []
+        {
+            QFile web_channel_api(":/qtwebchannel/qwebchannel.js");
+
+            if (!web_channel_api.open(QIODevice::ReadOnly))
+            {
+                throw std::runtime_error("Failed to open required qwebchannel.js");
+            }
+
+            auto content = web_channel_api.readAll().toStdString();
+            web_channel_api.close();
+
+            return content +
+                   R"js(
+                    window.saucer = 
+                    {
+                        window_edge:
+                        {
+                            top:    1,
+                            bottom: 2,
+                            left:   4,
+                            right:  8,
+                        },
+                        on_message: async (message) =>
+                        {
+                            (await window._saucer).on_message(message);
+                        },
+                        start_drag: async () =>
+                        {
+                            await window.saucer.on_message(JSON.stringify({
+                                ["saucer:drag"]: true
+                            }));
+                        },
+                        start_resize: async (edge) =>
+                        {
+                            await window.saucer.on_message(JSON.stringify({
+                                ["saucer:resize"]: true,
+                                edge,
+                            }));
+                        }
+                    };
 
-    const std::string webview::impl::inject_script = []()
+                    window._saucer = new Promise((resolve) =>
+                    {
+                        new QWebChannel(qt.webChannelTransport, function(channel) { 
+                            resolve(channel.objects.saucer); 
+                        });
+                    });
+
+                    document.addEventListener("DOMContentLoaded", () => window.saucer.on_message("dom_loaded"));
+                )js";
+        }();
+
+        return rtn;
+    }
+
+    void webview::impl::inject_startup()
     {
-        QFile web_channel_api(":/qtwebchannel/qwebchannel.js");
+        if (startup_injected)
+        {
+            return;
+        }
+
+        startup_injected = true;
+
+        auto &scripts = web_view->page()->scripts();
+        auto source   = QString::fromStdString(inject_script());
+
+        QWebEngineScript script;
+        bool found = false;
 
-        if (!web_channel_api.open(QIODevice::ReadOnly))
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        if (auto previous = scripts.find("_creation"); !previous.empty())
         {
-            throw std::runtime_error("Failed to open required qwebchannel.js");
+            found  = true;
+            script = previous.front();
         }
+#else
+        script = scripts.findScript("_creation");
+        found  = !script.isNull();
+#endif
 
-        auto content = web_channel_api.readAll().toStdString();
-        web_channel_api.close();
+        //? Scripts that were injected before the first navigation rely on `window.saucer`, so it has to come first.
 
-        return content +
-               R"js(
-                window.saucer = 
-                {
-                    window_edge:
-                    {
-                        top:    1,
-                        bottom: 2,
-                        left:   4,
-                        right:  8,
-                    },
-                    on_message: async (message) =>
-                    {
-                        (await window._saucer).on_message(message);
-                    },
-                    start_drag: async () =>
-                    {
-                        await window.saucer.on_message(JSON.stringify({
-                            ["saucer:drag"]: true
-                        }));
-                    },
-                    start_resize: async (edge) =>
-                    {
-                        await window.saucer.on_message(JSON.stringify({
-                            ["saucer:resize"]: true,
-                            edge,
-                        }));
-                    }
-                };
+        if (found)
+        {
+            scripts.remove(script);
+            source += "\n" + script.sourceCode();
+        }
+        else
+        {
+            script.setName("_creation");
+            script.setRunsOnSubFrames(false);
+            script.setWorldId(QWebEngineScript::MainWorld);
+            script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+        }
 
-                window._saucer = new Promise((resolve) =>
-                {
-                    new QWebChannel(qt.webChannelTransport, function(channel) { 
-                        resolve(channel.objects.saucer); 
-                    });
-                });
-            )js";
-    }();
+        script.setSourceCode(source);
+        scripts.insert(script);
+    }
 
     webview::impl::web_class::web_class(webview *parent) : QObject(parent->m_impl->web_view), m_parent(parent) {}
 
@@ -73,7 +130,8 @@ namespace saucer
 
     void webview::impl::url_scheme_handler::requestStarted(QWebEngineUrlRequestJob *request)
     {
-        auto url = request->requestUrl().toString(QUrl::RemoveQuery).toStdString();
+        const auto raw = request->requestUrl().toString(QUrl::RemoveQuery).toUtf8();
+        auto url       = std::string_view{raw.constData(), static_cast<std::size_t>(raw.size())};
 
         if (!url.starts_with(scheme_prefix))
         {
@@ -81,28 +139,90 @@ namespace saucer
             return;
         }
 
-        url = url.substr(scheme_prefix.size());
+        url.remove_prefix(scheme_prefix.size());
 
-        if (!m_parent->m_embedded_files.contains(url))
+        if (auto handler = m_parent->find_handler(url); handler)
         {
-            request->fail(QWebEngineUrlRequestJob::UrlNotFound);
+            auto *device = new stream_device{request};
+            auto state   = device->shared();
+
+            //? Cancel right away instead of waiting for the device to be deleted, so that blocked writers return.
+            connect(request, &QObject::destroyed, device, [state] { state->cancel(); });
+            connect(request, &QObject::destroyed, device, &QObject::deleteLater);
+
+            auto &streams = m_parent->m_impl->streams;
+            std::erase_if(streams, [](const auto &stream) { return stream.expired(); });
+            streams.emplace_back(state);
+
+            scheme_request req{
+                .url    = request->requestUrl().toString().toStdString(),
+                .path   = std::string{url},
+                .method = request->requestMethod().toStdString(),
+            };
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
+            for (const auto &[key, value] : request->requestHeaders().asKeyValueRange())
+            {
+                req.headers.emplace(key.toStdString(), value.toStdString());
+            }
+#endif
+
+            auto stream = scheme_stream{std::make_shared<scheme_stream::impl>(std::move(state))};
+
+            m_parent->m_impl->workers->submit(
+                [handler, req = std::move(req), stream]() mutable
+                {
+                    try
+                    {
+                        (*handler)(req, stream);
+                    }
+                    catch (...)
+                    {
+                        stream.fail();
+                    }
+                });
+
             return;
         }
 
-        const auto &file = m_parent->m_embedded_files.at(url);
+        std::optional<asset> result;
+        std::string_view mime;
+
+        if (auto file = m_parent->find_embedded(url); file)
+        {
+            result = m_parent->m_impl->assets.load(*file);
+            mime   = file->mime;
+        }
+        else if (auto [directory, entry] = asset_directory::find(m_parent->m_impl->directories, url); entry)
+        {
+            result = directory->load(*entry);
+            mime   = entry->mime;
+        }
+        else
+        {
+            request->fail(QWebEngineUrlRequestJob::UrlNotFound);
+            return;
+        }
 
-        auto *buffer = new QBuffer;
-        buffer->open(QIODevice::WriteOnly);
+        if (!result)
+        {
+            request->fail(QWebEngineUrlRequestJob::RequestFailed);
+            return;
+        }
 
-        auto size           = file.content.size();
-        const auto *content = file.content.data();
+        //? The device is not sequential, which lets QtWebEngine answer range requests by seeking it, so media can be
+        //? streamed from mapped files without reading them completely.
+        auto *device = new span_device{result->content, std::move(result->owner)};
 
-        buffer->write(reinterpret_cast<const char *>(content), static_cast<std::int64_t>(size));
-        buffer->close();
+        connect(request, &QObject::destroyed, device, &QObject::deleteLater);
 
-        connect(request, &QObject::destroyed, buffer, &QObject::deleteLater);
+        request->reply(QByteArray{mime.data(), static_cast<int>(mime.size())}, device);
+    }
 
-        request->reply(QString::fromStdString(file.mime).toUtf8(), buffer);
+    void webview::impl::install_scheme_handler(webview *parent)
+    {
+        scheme_handler = new url_scheme_handler(parent);
+        web_view->page()->profile()->installUrlSchemeHandler("saucer", scheme_handler);
     }
 
     template <>
@@ -7,7 +7,9 @@
 #include "utils.win32.hpp"
 #include "window.win32.impl.hpp"
 
+#include <thread>
 #include <cassert>
+#include <algorithm>
 #include <filesystem>
 
 #include <shlobj.h>
@@ -109,18 +111,19 @@ namespace saucer
         webview2_2->add_DOMContentLoaded(mcb{[this](auto...)
                                              {
                                                  m_impl->dom_loaded = true;
+                                                 record(startup_phase::dom_ready);
 
+                                                 //? Ready scripts run first, followed by the queued ones.
                                                  for (const auto &script : m_impl->scripts)
                                                  {
                                                      execute(script);
                                                  }
 
-                                                 for (const auto &pending : m_impl->pending)
+                                                 for (const auto &script : m_impl->pending.flush())
                                                  {
-                                                     execute(pending);
+                                                     execute(script);
                                                  }
 
-                                                 m_impl->pending.clear();
                                                  m_events.at<web_event::dom_ready>().fire();
 
                                                  return S_OK;
@@ -128,9 +131,39 @@ namespace saucer
                                          nullptr);
 
         inject(impl::inject_script.data(), load_time::creation);
+        record(startup_phase::engine);
     }
 
-    webview::~webview() = default;
+    webview::~webview()
+    {
+        //? Streams that outlive the webview must not post their response to the window anymore.
+
+        for (const auto &stream : m_impl->streams)
+        {
+            if (auto state = stream.lock(); state)
+            {
+                state->cancel();
+            }
+        }
+
+        //? Handlers that still do not return (i.e. because they wait on a slow producer) are detached rather than
+        //? joined once the timeout passes, so that they can not hang the UI thread. Anything they write afterwards is
+        //? dropped.
+
+        if (!m_impl->workers)
+        {
+            return;
+        }
+
+        const auto abandoned = m_impl->workers->shutdown(m_impl->handler_timeout, [] { run<false>(); });
+
+        if (abandoned > 0 && m_impl->on_abandon)
+        {
+            m_impl->on_abandon(abandoned);
+        }
+
+        m_impl->workers.reset();
+    }
 
     bool webview::on_message(const std::string &message)
     {
@@ -269,11 +302,63 @@ namespace saucer
         m_impl->install_scheme_handler(this);
     }
 
+    void webview::embed(embedded_table table)
+    {
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe([this, table] { return embed(table); });
+        }
+
+        m_embedded_tables.emplace_back(table);
+
+        if (m_impl->scheme_handler.value > 0)
+        {
+            return;
+        }
+
+        m_impl->install_scheme_handler(this);
+    }
+
+    void webview::set_embedded_cache(std::size_t limit)
+    {
+        m_impl->assets.set_limit(limit);
+    }
+
     void webview::serve(const std::string &file)
     {
         set_url(std::string{impl::scheme_prefix} + file);
     }
 
+    void webview::serve_directory(const std::filesystem::path &directory)
+    {
+        serve_directory(directory, asset_directory::default_budget);
+    }
+
+    void webview::serve_directory(const std::filesystem::path &directory, std::size_t budget)
+    {
+        //? The directory is indexed on the calling thread, only registering it happens on the UI thread.
+        auto mount = std::make_shared<asset_directory>(directory, budget);
+
+        auto callback = [this, mount]
+        {
+            m_impl->directories.emplace_back(mount);
+
+            if (m_impl->scheme_handler.value > 0)
+            {
+                return;
+            }
+
+            m_impl->install_scheme_handler(this);
+        };
+
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe(callback);
+        }
+
+        callback();
+    }
+
     void webview::clear_scripts()
     {
         if (!window::m_impl->is_thread_safe())
@@ -289,6 +374,40 @@ namespace saucer
         m_impl->injected.clear();
     }
 
+    void webview::remove_handler(const std::string &prefix)
+    {
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe([this, prefix] { return remove_handler(prefix); });
+        }
+
+        m_handlers.erase(prefix);
+    }
+
+    void webview::handle(const std::string &prefix, response_handler handler)
+    {
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe([this, prefix, handler = std::move(handler)]() mutable
+                                             { return handle(prefix, std::move(handler)); });
+        }
+
+        if (!m_impl->workers)
+        {
+            //? Handlers are expected to block on I/O, so the pool is sized independently of the shared executor.
+            m_impl->workers = std::make_unique<executor>(std::max(std::thread::hardware_concurrency() / 2, 2u));
+        }
+
+        m_handlers[prefix] = std::make_shared<response_handler>(std::move(handler));
+
+        if (m_impl->scheme_handler.value > 0)
+        {
+            return;
+        }
+
+        m_impl->install_scheme_handler(this);
+    }
+
     void webview::clear_embedded()
     {
         if (!window::m_impl->is_thread_safe())
@@ -297,8 +416,11 @@ namespace saucer
         }
 
         m_embedded_files.clear();
+        m_embedded_tables.clear();
+        m_impl->assets.clear();
+        m_impl->directories.clear();
 
-        if (m_impl->scheme_handler.value <= 0)
+        if (m_impl->scheme_handler.value <= 0 || !m_handlers.empty())
         {
             return;
         }
@@ -320,7 +442,26 @@ namespace saucer
 
         if (!m_impl->dom_loaded)
         {
-            m_impl->pending.emplace_back(java_script);
+            m_impl->pending.push(java_script);
+            return;
+        }
+
+        if (!SUCCEEDED(m_impl->web_view->ExecuteScript(utils::widen(java_script).c_str(), nullptr)))
+        {
+            assert("Failed to execute script" && false);
+        }
+    }
+
+    void webview::execute_internal(const std::string &java_script)
+    {
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe([this, java_script] { return execute_internal(java_script); });
+        }
+
+        if (!m_impl->dom_loaded)
+        {
+            m_impl->pending.push(java_script, true);
             return;
         }
 
@@ -330,6 +471,48 @@ namespace saucer
         }
     }
 
+    startup_timings webview::startup() const
+    {
+        return window::m_impl->startup.timings();
+    }
+
+    void webview::record(startup_phase phase)
+    {
+        window::m_impl->startup.record(phase);
+    }
+
+    pending_stats webview::pending() const
+    {
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe([this] { return pending(); });
+        }
+
+        return m_impl->pending.stats();
+    }
+
+    void webview::set_handler_timeout(std::chrono::milliseconds timeout, std::function<void(std::size_t)> on_abandon)
+    {
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe([this, timeout, on_abandon = std::move(on_abandon)]() mutable
+                                             { return set_handler_timeout(timeout, std::move(on_abandon)); });
+        }
+
+        m_impl->handler_timeout = timeout;
+        m_impl->on_abandon      = std::move(on_abandon);
+    }
+
+    void webview::set_pending_limit(std::size_t limit)
+    {
+        if (!window::m_impl->is_thread_safe())
+        {
+            return window::m_impl->post_safe([this, limit] { return set_pending_limit(limit); });
+        }
+
+        m_impl->pending.set_limit(limit);
+    }
+
     void webview::inject(const std::string &java_script, const load_time &load_time)
     {
         if (java_script.empty())
@@ -1,4 +1,6 @@
+#include "byte_range.hpp"
 #include "utils.win32.hpp"
+#include "window.win32.impl.hpp"
 #include "webview.webview2.impl.hpp"
 
 #include <fmt/core.h>
@@ -82,28 +84,192 @@ namespace saucer
                 return S_OK;
             }
 
-            url = url.substr(scheme_prefix.size());
-            url = url.substr(0, url.find_first_of('?'));
+            auto path = std::string_view{url}.substr(scheme_prefix.size());
+            path      = path.substr(0, path.find_first_of('?'));
 
-            if (!parent->m_embedded_files.contains(url))
+            auto respond = [&](IStream *data, int status, LPCWSTR reason, const std::wstring &headers)
             {
                 ComPtr<ICoreWebView2WebResourceResponse> response;
-                environment->CreateWebResourceResponse(nullptr, 404, L"Not Found", L"", &response);
+                environment->CreateWebResourceResponse(data, status, reason, headers.c_str(), &response);
 
                 args->put_Response(response.Get());
                 return S_OK;
+            };
+
+            if (auto handler = parent->find_handler(path); handler)
+            {
+                scheme_request req{.url = url, .path = std::string{path}};
+
+                if (LPWSTR method{}; SUCCEEDED(request->get_Method(&method)) && method)
+                {
+                    req.method = utils::narrow(method);
+                    CoTaskMemFree(method);
+                }
+
+                ComPtr<ICoreWebView2HttpRequestHeaders> headers;
+                ComPtr<ICoreWebView2HttpHeadersCollectionIterator> iterator;
+
+                if (SUCCEEDED(request->get_Headers(&headers)) && SUCCEEDED(headers->GetIterator(&iterator)))
+                {
+                    BOOL current{};
+
+                    while (SUCCEEDED(iterator->get_HasCurrentHeader(&current)) && current)
+                    {
+                        LPWSTR name{};
+                        LPWSTR value{};
+
+                        if (SUCCEEDED(iterator->GetCurrentHeader(&name, &value)))
+                        {
+                            req.headers.emplace(utils::narrow(name), utils::narrow(value));
+
+                            CoTaskMemFree(name);
+                            CoTaskMemFree(value);
+                        }
+
+                        BOOL next{};
+                        iterator->MoveNext(&next);
+                    }
+                }
+
+                ComPtr<ICoreWebView2Deferral> deferral;
+                args->GetDeferral(&deferral);
+
+                ComPtr<ICoreWebView2WebResourceRequestedEventArgs> event{args};
+
+                //? The COM objects are only used and released on the UI thread, the reply merely moves them into the
+                //? posted callback. The body is read by the engine on one of its own threads while the handler writes.
+
+                auto reply = [window = parent->window::m_impl.get(), event, environment,
+                              deferral](std::optional<std::string> mime, ComPtr<IStream> body) mutable
+                {
+                    auto callback = [event = std::move(event), environment = std::move(environment),
+                                     deferral = std::move(deferral), mime = std::move(mime), body = std::move(body)]
+                    {
+                        ComPtr<ICoreWebView2WebResourceResponse> response;
+
+                        if (!mime)
+                        {
+                            environment->CreateWebResourceResponse(nullptr, 500, L"Internal Server Error", L"",
+                                                                   &response);
+                        }
+                        else
+                        {
+                            const auto headers = fmt::format(L"Content-Type: {}", utils::widen(*mime));
+                            environment->CreateWebResourceResponse(body.Get(), 200, L"OK", headers.c_str(), &response);
+                        }
+
+                        event->put_Response(response.Get());
+                        deferral->Complete();
+                    };
+
+                    window->post(std::move(callback));
+                };
+
+                auto state  = std::make_shared<scheme_stream::impl>(std::move(reply));
+                auto stream = scheme_stream{state};
+
+                auto &streams = parent->m_impl->streams;
+                std::erase_if(streams, [](const auto &entry) { return entry.expired(); });
+                streams.emplace_back(state);
+
+                parent->m_impl->workers->submit(
+                    [handler, req = std::move(req), stream]() mutable
+                    {
+                        try
+                        {
+                            (*handler)(req, stream);
+                        }
+                        catch (...)
+                        {
+                            stream.fail();
+                        }
+                    });
+
+                return S_OK;
+            }
+
+            if (auto file = parent->find_embedded(path); file)
+            {
+                auto asset = parent->m_impl->assets.load(*file);
+
+                if (!asset)
+                {
+                    return respond(nullptr, 500, L"Internal Server Error", L"");
+                }
+
+                ComPtr<IStream> data;
+                data.Attach(SHCreateMemStream(asset->content.data(), static_cast<UINT>(asset->content.size())));
+
+                const auto mime = utils::widen(std::string{file->mime});
+                return respond(data.Get(), 200, L"OK", fmt::format(L"Content-Type: {}", mime));
             }
 
-            const auto &file = parent->m_embedded_files.at(url);
+            auto [directory, file] = asset_directory::find(parent->m_impl->directories, path);
+
+            if (!file)
+            {
+                return respond(nullptr, 404, L"Not Found", L"");
+            }
+
+            auto asset = directory->load(*file);
+
+            if (!asset)
+            {
+                return respond(nullptr, 500, L"Internal Server Error", L"");
+            }
+
+            //? WebView2 copies memory streams, so ranges are served in chunks of at most `max_range` bytes, which the
+            //? engine follows up on. Complete responses for larger files are read from disk by the stream instead.
+            static constexpr std::size_t max_range = 4 * 1024 * 1024;
+
+            const auto size = asset->content.size();
+            const auto mime = utils::widen(std::string{file->mime});
 
-            ComPtr<ICoreWebView2WebResourceResponse> response;
-            ComPtr<IStream> data = SHCreateMemStream(file.content.data(), static_cast<UINT>(file.content.size()));
+            std::string header;
+            ComPtr<ICoreWebView2HttpRequestHeaders> headers;
 
-            environment->CreateWebResourceResponse(
-                data.Get(), 200, L"OK", fmt::format(L"Content-Type: {}", utils::widen(file.mime)).c_str(), &response);
+            if (SUCCEEDED(request->get_Headers(&headers)))
+            {
+                LPWSTR value{};
+
+                if (SUCCEEDED(headers->GetHeader(L"Range", &value)) && value)
+                {
+                    header = utils::narrow(value);
+                    CoTaskMemFree(value);
+                }
+            }
+
+            auto [result, range] = parse_range(header, size, max_range);
+
+            if (result == range_result::unsatisfiable)
+            {
+                return respond(nullptr, 416, L"Range Not Satisfiable", fmt::format(L"Content-Range: bytes */{}", size));
+            }
+
+            ComPtr<IStream> data;
+
+            if (result == range_result::partial)
+            {
+                const auto length = range.last - range.first + 1;
+                data.Attach(SHCreateMemStream(asset->content.data() + range.first, static_cast<UINT>(length)));
+
+                const auto content_range = fmt::format(L"Content-Range: bytes {}-{}/{}", range.first, range.last, size);
+
+                return respond(data.Get(), 206, L"Partial Content",
+                               fmt::format(L"Content-Type: {}\r\nAccept-Ranges: bytes\r\n{}", mime, content_range));
+            }
+
+            if (size > max_range)
+            {
+                SHCreateStreamOnFileEx(file->path.c_str(), STGM_READ | STGM_SHARE_DENY_NONE, FILE_ATTRIBUTE_NORMAL,
+                                       FALSE, nullptr, &data);
+            }
+            else
+            {
+                data.Attach(SHCreateMemStream(asset->content.data(), static_cast<UINT>(size)));
+            }
 
-            args->put_Response(response.Get());
-            return S_OK;
+            return respond(data.Get(), 200, L"OK", fmt::format(L"Content-Type: {}\r\nAccept-Ranges: bytes", mime));
         };
 
         auto callback = mcb{handler};
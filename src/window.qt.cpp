@@ -48,6 +48,8 @@ namespace saucer
             application = new QApplication(argc, argv.data());
         }
 
+        m_impl->startup.record(startup_phase::application);
+
         m_impl->window = new impl::main_window(this);
 
         //? Fixes QT-Bug where Web-View will not render when background color is transparent.
@@ -56,6 +58,7 @@ namespace saucer
         palette.setColor(QPalette::ColorRole::Window, QColor(255, 255, 255));
 
         m_impl->window->setPalette(palette);
+        m_impl->startup.record(startup_phase::window);
     }
 
     window::~window()
@@ -195,6 +198,11 @@ namespace saucer
         m_impl->window->show();
     }
 
+    void window::dispatch(std::function<void()> callback)
+    {
+        QMetaObject::invokeMethod(m_impl->window, std::move(callback), Qt::QueuedConnection);
+    }
+
     void window::close()
     {
         if (!m_impl->is_thread_safe())
@@ -38,6 +38,8 @@ namespace saucer
             }
         }
 
+        m_impl->startup.record(startup_phase::application);
+
         const auto dw_style = IsWindows8OrGreater() ? WS_EX_NOREDIRECTIONBITMAP : 0;
 
         m_impl->hwnd = CreateWindowExW(dw_style,            //
@@ -62,6 +64,8 @@ namespace saucer
 
         SetWindowLongPtrW(m_impl->hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(this));
         impl::instances++;
+
+        m_impl->startup.record(startup_phase::window);
     }
 
     window::~window()
@@ -218,6 +222,11 @@ namespace saucer
         ShowWindow(m_impl->hwnd, SW_SHOW);
     }
 
+    void window::dispatch(std::function<void()> callback)
+    {
+        m_impl->post(std::move(callback));
+    }
+
     void window::close()
     {
         if (!m_impl->is_thread_safe())
@@ -0,0 +1,197 @@
+#include "cfg.hpp"
+
+#include <byte_range.hpp>
+#include <asset_cache.hpp>
+#include <mapped_file.hpp>
+#include <asset_directory.hpp>
+
+#include <span>
+#include <array>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <filesystem>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    void write(const fs::path &path, const std::string &content)
+    {
+        fs::create_directories(path.parent_path());
+        std::ofstream{path, std::ios::binary} << content;
+    }
+
+    std::string read(std::span<const std::uint8_t> content)
+    {
+        return {reinterpret_cast<const char *>(content.data()), content.size()};
+    }
+
+    bool same(const std::pair<saucer::range_result, saucer::byte_range> &value, saucer::range_result result,
+              std::size_t first = 0, std::size_t last = 0)
+    {
+        if (value.first != result)
+        {
+            return false;
+        }
+
+        return result == saucer::range_result::unsatisfiable ||
+               (value.second.first == first && value.second.last == last);
+    }
+} // namespace
+
+suite assets_suite = []
+{
+    "parse_range"_test = []
+    {
+        using enum saucer::range_result;
+        using saucer::parse_range;
+
+        expect(same(parse_range("bytes=0-9", 100, 0), partial, 0, 9));
+        expect(same(parse_range("bytes=90-", 100, 0), partial, 90, 99));
+        expect(same(parse_range("bytes=-10", 100, 0), partial, 90, 99));
+        expect(same(parse_range("bytes=-500", 100, 0), partial, 0, 99));
+        expect(same(parse_range("bytes=50-500", 100, 0), partial, 50, 99));
+        expect(same(parse_range("bytes=0-", 100, 10), partial, 0, 9));
+
+        expect(same(parse_range("", 100, 0), full, 0, 99));
+        expect(same(parse_range("bytes=5-3", 100, 0), full, 0, 99));
+        expect(same(parse_range("bytes=0-1,5-6", 100, 0), full, 0, 99));
+        expect(same(parse_range("bytes=a-b", 100, 0), full, 0, 99));
+        expect(same(parse_range("bytes=5-abc", 100, 0), full, 0, 99));
+        expect(same(parse_range("bytes=abc-10", 100, 0), full, 0, 99));
+        expect(same(parse_range("bytes=5-10x", 100, 0), full, 0, 99));
+        expect(same(parse_range("items=0-1", 100, 0), full, 0, 99));
+
+        expect(same(parse_range("bytes=100-", 100, 0), unsatisfiable));
+        expect(same(parse_range("bytes=-0", 100, 0), unsatisfiable));
+        expect(same(parse_range("bytes=-1", 0, 0), unsatisfiable));
+    };
+
+    "mapped_file"_test = []
+    {
+        const auto root = fs::temp_directory_path() / "saucer-mapped-file";
+
+        write(root / "content.txt", "content");
+        write(root / "empty.txt", "");
+
+        auto content = saucer::mapped_file::open(root / "content.txt");
+
+        expect(content != nullptr);
+        expect(read(content->data()) == "content");
+
+        auto empty = saucer::mapped_file::open(root / "empty.txt");
+
+        expect(empty != nullptr);
+        expect(empty->data().empty());
+
+        expect(saucer::mapped_file::open(root / "missing.txt") == nullptr);
+
+        fs::remove_all(root);
+    };
+
+    "asset_directory"_test = []
+    {
+        const auto base    = fs::temp_directory_path() / "saucer-asset-directory";
+        const auto root    = base / "root";
+        const auto outside = base / "outside";
+
+        fs::remove_all(base);
+
+        write(root / "index.html", "<html></html>");
+        write(root / "nested dir" / "app.js", "console.log(1);");
+        write(outside / "secret.txt", "secret");
+
+        std::error_code ec;
+
+        fs::create_symlink(outside / "secret.txt", root / "secret.txt", ec);
+        fs::create_directory_symlink(outside, root / "escape", ec);
+        fs::create_symlink(root / "index.html", root / "alias.html", ec);
+
+        saucer::asset_directory directory{root, 16};
+
+        const auto index = directory.find("index.html");
+
+        expect(index.has_value());
+        expect(index->mime == "text/html");
+        expect(eq(index->size, 13u));
+
+        expect(directory.find("nested dir/app.js").has_value());
+        expect(directory.find("nested%20dir/app.js")->path == directory.find("nested dir/app.js")->path);
+
+        expect(not directory.find("secret.txt").has_value());
+        expect(not directory.find("escape/secret.txt").has_value());
+        expect(not directory.find("../outside/secret.txt").has_value());
+        expect(not directory.find("/etc/passwd").has_value());
+
+        if (!ec)
+        {
+            expect(directory.find("alias.html").has_value());
+        }
+
+        auto loaded = directory.load(*index);
+
+        expect(loaded.has_value());
+        expect(read(loaded->content) == "<html></html>");
+
+        //? Files above the budget are still served, they are just not kept.
+
+        auto script = directory.load(*directory.find("nested dir/app.js"));
+
+        expect(script.has_value());
+        expect(read(script->content) == "console.log(1);");
+
+        //? Changes on disk are picked up on the next lookup, while content that is being served stays untouched.
+
+        write(root / "index.html", "<html><body></body></html>");
+        fs::last_write_time(root / "index.html", fs::last_write_time(root / "index.html") + std::chrono::seconds{1});
+
+        const auto changed = directory.find("index.html");
+
+        expect(changed.has_value());
+        expect(eq(changed->size, 26u));
+        expect(read(directory.load(*changed)->content) == "<html><body></body></html>");
+        expect(read(loaded->content) == "<html></html>");
+
+        write(root / "late.css", "body {}");
+
+        const auto late = directory.find("late.css");
+
+        expect(late.has_value());
+        expect(late->mime == "text/css");
+        expect(read(directory.load(*late)->content) == "body {}");
+
+        fs::remove(root / "late.css");
+        expect(not directory.find("late.css").has_value());
+
+        fs::remove_all(base);
+    };
+
+    "asset_cache"_test = []
+    {
+        static constexpr std::array<std::uint8_t, 3> content{1, 2, 3};
+
+        saucer::asset_cache cache{16};
+
+        auto plain = cache.load({"plain.bin", "application/octet-stream", content});
+
+        expect(plain.has_value());
+        expect(plain->content.data() == content.data());
+        expect(eq(cache.size(), 0u));
+
+        //? Content that fails to decode is never served, whether or not brotli support is compiled in.
+
+        auto broken = cache.load({"broken.bin", "text/plain", content, saucer::embedded_encoding::brotli, 8});
+
+        expect(not broken.has_value());
+        expect(eq(cache.size(), 0u));
+
+        cache.clear();
+        cache.set_limit(0);
+
+        expect(eq(cache.size(), 0u));
+    };
+};
@@ -0,0 +1,76 @@
+#include "cfg.hpp"
+
+#include <saucer/deferred.hpp>
+
+#include <thread>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+struct fake_view
+{
+    std::vector<std::string> urls;
+
+  public:
+    fake_view(const saucer::options &) {}
+
+  public:
+    void set_url(const std::string &url)
+    {
+        urls.emplace_back(url);
+    }
+};
+
+suite deferred_suite = []
+{
+    "deferred"_test = []
+    {
+        saucer::deferred<fake_view> deferred;
+
+        auto ready = deferred.ready();
+        expect(ready.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+
+        deferred.set_url("first");
+
+        std::thread init{[&] { deferred.set_url("second"); }};
+        init.join();
+
+        auto view = deferred.create();
+
+        expect(ready.get() == view.get());
+        expect(eq(view->urls.size(), 2u));
+        expect(eq(view->urls[0], std::string{"first"}));
+
+        deferred.set_url("third");
+        deferred.then([](fake_view &target) { target.urls.emplace_back("fourth"); });
+
+        expect(eq(view->urls.size(), 4u));
+        expect(eq(view->urls[3], std::string{"fourth"}));
+    };
+
+    "deferred_create_once"_test = []
+    {
+        saucer::deferred<fake_view> deferred;
+
+        auto view = deferred.create();
+        expect(throws<std::future_error>([&] { static_cast<void>(deferred.create()); }));
+
+        expect(deferred.ready().get() == view.get());
+    };
+
+    "deferred_replay_failure"_test = []
+    {
+        saucer::deferred<fake_view> deferred;
+
+        deferred.then([](fake_view &) { throw std::runtime_error{"replay"}; });
+        expect(throws<std::runtime_error>([&] { static_cast<void>(deferred.create()); }));
+
+        auto ready = deferred.ready();
+
+        expect(ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        expect(throws<std::runtime_error>([&] { ready.get(); }));
+    };
+};
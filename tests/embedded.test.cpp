@@ -0,0 +1,66 @@
+#include "cfg.hpp"
+
+#include <saucer/utils/embedded.hpp>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+static constexpr std::array<std::uint8_t, 3> content{1, 2, 3};
+
+static constexpr auto table = saucer::make_embedded_table(std::array{
+    saucer::embedded_entry{"index.html", "text/html", content},
+    saucer::embedded_entry{"index.js", "application/javascript", content},
+    saucer::embedded_entry{"style/style.css", "text/css", content},
+});
+
+static_assert(saucer::embedded_table{table}.find("index.js") == &table.entries[1]);
+static_assert(saucer::embedded_table{table}.find("index.jsx") == nullptr);
+
+suite embedded_suite = []
+{
+    "embedded_table"_test = []
+    {
+        const saucer::embedded_table view = table;
+
+        expect(eq(view.size(), 3u));
+
+        for (const auto &entry : view)
+        {
+            expect(view.find(entry.path) == &entry);
+        }
+
+        expect(view.find("") == nullptr);
+        expect(view.find("style") == nullptr);
+        expect(saucer::embedded_table{}.find("index.html") == nullptr);
+    };
+
+    "embedded_table_many"_test = []
+    {
+        std::array<std::string, 500> paths;
+        std::array<saucer::embedded_entry, 500> entries;
+
+        for (auto i = 0u; paths.size() > i; i++)
+        {
+            paths[i]   = "src/components/" + std::to_string(i) + "/index.js";
+            entries[i] = {paths[i], "application/javascript", content};
+        }
+
+        const auto storage = saucer::make_embedded_table(entries);
+        const saucer::embedded_table view = storage;
+
+        for (auto i = 0u; entries.size() > i; i++)
+        {
+            expect(view.find(paths[i]) == &storage.entries[i]);
+        }
+    };
+
+    "embedded_table_duplicates"_test = []
+    {
+        std::array entries{
+            saucer::embedded_entry{"index.html", "text/html", content},
+            saucer::embedded_entry{"index.html", "text/html", content},
+        };
+
+        expect(throws([&] { std::ignore = saucer::make_embedded_table(entries); }));
+    };
+};
@@ -0,0 +1,69 @@
+#include "cfg.hpp"
+
+#include <executor.hpp>
+
+#include <atomic>
+#include <future>
+#include <memory>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+suite executor_suite = []
+{
+    "self_destruct"_test = []
+    {
+        //? An abandoned call may hold the last reference to the executor it runs on.
+
+        auto pool  = std::make_shared<saucer::executor>(2);
+        auto *self = pool.get();
+
+        std::promise<void> done;
+
+        self->submit(
+            [pool = std::move(pool), &done]() mutable
+            {
+                pool.reset();
+                done.set_value();
+            });
+
+        expect(done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    };
+
+    "shutdown"_test = []
+    {
+        using namespace std::chrono_literals;
+
+        saucer::executor idle{2};
+        expect(eq(idle.shutdown(1s), 0u));
+
+        //? A task that never returns must not keep the shutdown from finishing, tasks that did not start are dropped.
+
+        auto release = std::make_shared<std::promise<void>>();
+        auto started = std::make_shared<std::promise<void>>();
+        auto ran     = std::make_shared<std::atomic_bool>(false);
+
+        auto pool = std::make_unique<saucer::executor>(1);
+
+        pool->submit(
+            [release, started]
+            {
+                started->set_value();
+                release->get_future().wait();
+            });
+
+        pool->submit([ran] { ran->store(true); });
+        started->get_future().wait();
+
+        auto pumped = 0u;
+
+        expect(eq(pool->shutdown(50ms, [&pumped] { pumped++; }), 1u));
+        expect(pumped > 0u);
+
+        pool.reset();
+        release->set_value();
+
+        std::this_thread::sleep_for(50ms);
+        expect(not ran->load());
+    };
+};
@@ -0,0 +1,172 @@
+#include "cfg.hpp"
+
+#include <gate.hpp>
+
+#include <thread>
+#include <vector>
+#include <functional>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+suite gate_suite = []
+{
+    "concurrency"_test = []
+    {
+        saucer::gate gate;
+        gate.configure({.in_flight = 2});
+
+        expect(gate.enter() == saucer::gate::verdict::admitted);
+        expect(gate.enter() == saucer::gate::verdict::admitted);
+        expect(gate.enter() == saucer::gate::verdict::rejected);
+
+        expect(not gate.leave().has_value());
+        expect(gate.enter() == saucer::gate::verdict::admitted);
+
+        auto stats = gate.stats();
+
+        expect(eq(stats.admitted, 3u));
+        expect(eq(stats.rejected, 1u));
+    };
+
+    "rate"_test = []
+    {
+        using namespace std::chrono_literals;
+
+        saucer::gate gate;
+        gate.configure({.per_second = 20});
+
+        for (auto i = 0; 20 > i; i++)
+        {
+            expect(gate.enter() == saucer::gate::verdict::admitted);
+            expect(not gate.leave().has_value());
+        }
+
+        expect(gate.enter() == saucer::gate::verdict::rejected);
+
+        std::this_thread::sleep_for(100ms);
+        expect(gate.enter() == saucer::gate::verdict::admitted);
+    };
+
+    "backlog"_test = []
+    {
+        saucer::gate gate;
+        gate.configure({.in_flight = 1, .backlog = 1});
+
+        auto ran = 0;
+
+        std::function<void()> first  = [&] { ran = 1; };
+        std::function<void()> second = [&] { ran = 2; };
+
+        expect(gate.enter() == saucer::gate::verdict::admitted);
+        expect(gate.enter(&first) == saucer::gate::verdict::queued);
+        expect(gate.enter(&second) == saucer::gate::verdict::rejected);
+
+        auto next = gate.leave();
+
+        expect(next.has_value());
+        (*next)();
+
+        expect(eq(ran, 1));
+        expect(not gate.leave().has_value());
+
+        auto stats = gate.stats();
+
+        expect(eq(stats.admitted, 2u));
+        expect(eq(stats.queued, 1u));
+        expect(eq(stats.rejected, 1u));
+    };
+
+    "backlog_rate"_test = []
+    {
+        using namespace std::chrono_literals;
+
+        saucer::gate gate;
+        gate.configure({.in_flight = 1, .per_second = 1, .backlog = 2});
+
+        std::function<void()> first  = [] {};
+        std::function<void()> second = [] {};
+
+        expect(gate.enter() == saucer::gate::verdict::admitted);
+        expect(gate.enter(&first) == saucer::gate::verdict::queued);
+        expect(gate.enter(&second) == saucer::gate::verdict::queued);
+
+        //? The only token was taken by the first call, the queued ones have to wait for the bucket to refill.
+
+        expect(not gate.leave().has_value());
+
+        auto delay = gate.retry();
+
+        expect(delay.has_value());
+        expect(*delay > 0ms && 1s >= *delay);
+        expect(not gate.retry().has_value());
+
+        expect(not gate.poll().has_value());
+        expect(gate.retry().has_value());
+
+        auto flushed = gate.flush();
+
+        expect(eq(flushed.size(), 2u));
+        expect(not gate.retry().has_value());
+        expect(eq(gate.stats().admitted, 3u));
+    };
+    "fifo"_test = []
+    {
+        using namespace std::chrono_literals;
+
+        saucer::gate gate;
+        gate.configure({.per_second = 2, .backlog = 4});
+
+        std::vector<int> order;
+
+        auto finish = [&]
+        {
+            for (auto next = gate.leave(); next; next = gate.leave())
+            {
+                (*next)();
+            }
+        };
+
+        auto submit = [&](int id)
+        {
+            std::function<void()> task = [&order, id]
+            {
+                order.emplace_back(id);
+            };
+
+            auto verdict = gate.enter(&task);
+
+            if (verdict == saucer::gate::verdict::admitted)
+            {
+                task();
+                finish();
+            }
+
+            return verdict;
+        };
+
+        expect(submit(1) == saucer::gate::verdict::admitted);
+        expect(submit(2) == saucer::gate::verdict::admitted);
+        expect(submit(3) == saucer::gate::verdict::queued);
+
+        //? A token is available again, it still belongs to the call that waited for it first.
+
+        std::this_thread::sleep_for(600ms);
+        expect(submit(4) == saucer::gate::verdict::queued);
+
+        for (auto i = 0; 50 > i && 4 > order.size(); i++)
+        {
+            if (auto next = gate.poll(); next)
+            {
+                (*next)();
+                finish();
+
+                continue;
+            }
+
+            std::this_thread::sleep_for(100ms);
+        }
+
+        expect(order == std::vector<int>{1, 2, 3, 4});
+    };
+};
@@ -0,0 +1,23 @@
+#include "cfg.hpp"
+
+//? Qt defines `emit`, `signals` and `slots` as macros, including a Qt header first must not break the smartview.
+
+#if __has_include(<QObject>)
+#include <QObject>
+#endif
+
+#include <saucer/smartview.hpp>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+static_assert(requires(saucer::smartview<> &smartview) { smartview.send_event("event", 1, "value"); });
+
+suite keywords_suite = []
+{
+    "make_event"_test = []
+    {
+        auto event = saucer::smartview<>::make_event("event", 1, "value");
+        expect(eq(event.code, std::string{R"(window.saucer._emit("event", [1, "value", ]);)"}));
+    };
+};
@@ -0,0 +1,93 @@
+#include "cfg.hpp"
+
+#include <saucer/pool.hpp>
+
+#include <string>
+#include <vector>
+#include <functional>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+namespace
+{
+    std::size_t created{0};
+    std::vector<std::function<void()>> dispatched;
+
+    struct fake_view
+    {
+        std::string url;
+
+      public:
+        fake_view(const saucer::options &)
+        {
+            created++;
+        }
+
+      public:
+        void set_url(const std::string &value)
+        {
+            url = value;
+        }
+
+        void dispatch(std::function<void()> callback)
+        {
+            dispatched.emplace_back(std::move(callback));
+        }
+    };
+
+    void drain()
+    {
+        while (!dispatched.empty())
+        {
+            auto callbacks = std::move(dispatched);
+            dispatched.clear();
+
+            for (auto &callback : callbacks)
+            {
+                callback();
+            }
+        }
+    }
+} // namespace
+
+suite pool_suite = []
+{
+    "view_pool"_test = []
+    {
+        saucer::view_pool<fake_view> pool{2};
+
+        //? Only the first view is built right away, the second one follows once the event loop runs.
+
+        expect(eq(created, 1u));
+        expect(eq(pool.available(), 1u));
+
+        drain();
+
+        expect(eq(created, 2u));
+        expect(eq(pool.available(), 2u));
+
+        auto first  = pool.acquire();
+        auto second = pool.acquire();
+
+        expect(eq(first->url, std::string{"about:blank"}));
+        expect(eq(pool.available(), 0u));
+        expect(eq(created, 2u));
+
+        drain();
+
+        expect(eq(pool.available(), 2u));
+        expect(eq(created, 4u));
+
+        pool.resize(1);
+        expect(eq(pool.available(), 1u));
+
+        pool.resize(0);
+        auto third = pool.acquire();
+
+        drain();
+
+        expect(eq(pool.available(), 0u));
+        expect(eq(created, 5u));
+    };
+};
@@ -0,0 +1,99 @@
+#include "cfg.hpp"
+
+#include <script_queue.hpp>
+
+#include <vector>
+#include <string>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+suite script_queue_suite = []
+{
+    "limit"_test = []
+    {
+        saucer::script_queue queue{2};
+
+        queue.push("void 0;");
+        queue.push("void 1;");
+        queue.push("void 2;");
+
+        auto stats = queue.stats();
+
+        expect(eq(stats.scripts, 2u));
+        expect(eq(stats.bytes, 14u));
+        expect(eq(stats.dropped, 1u));
+
+        const auto scripts = queue.flush();
+
+        expect(eq(scripts.size(), 2u));
+        expect(scripts[0] == "void 1;");
+        expect(queue.empty());
+    };
+
+    "internal"_test = []
+    {
+        saucer::script_queue queue{1};
+
+        queue.push("bridge();", true);
+        queue.push("user(0);");
+        queue.push("resolve();", true);
+        queue.push("user(1);");
+
+        //? Only user scripts count towards the limit, internal ones are never dropped.
+
+        auto stats = queue.stats();
+
+        expect(eq(stats.scripts, 3u));
+        expect(eq(stats.dropped, 1u));
+
+        queue.set_limit(0);
+        expect(eq(queue.stats().scripts, 3u));
+
+        const auto scripts = queue.flush();
+
+        //? The user script that was dropped no longer separates the internal ones, which now share one batch.
+
+        expect(eq(scripts.size(), 2u));
+        expect(scripts[0].find("bridge();") < scripts[0].find("resolve();"));
+        expect(scripts[1] == "user(1);");
+    };
+
+    "flush"_test = []
+    {
+        saucer::script_queue queue;
+
+        queue.push("throw 1; // comment");
+        queue.push("const broken = (;");
+
+        //? User scripts are handed out as they were queued, so that each one is executed natively and on its own.
+
+        const auto scripts = queue.flush();
+
+        expect(scripts == std::vector<std::string>{"throw 1; // comment", "const broken = (;"});
+
+        expect(queue.empty());
+        expect(eq(queue.stats().bytes, 0u));
+        expect(queue.flush().empty());
+    };
+
+    "batch"_test = []
+    {
+        saucer::script_queue queue;
+
+        queue.push("first();", true);
+        queue.push("throw 1;", true);
+        queue.push("user();");
+        queue.push("last();", true);
+
+        //? Every internal script of a batch is isolated in its own try-block, the order is kept across batches.
+
+        const auto scripts = queue.flush();
+
+        expect(eq(scripts.size(), 3u));
+        expect(scripts[0] == "try {\nfirst();\n} catch (error) { console.error(error); }\n"
+                             "try {\nthrow 1;\n} catch (error) { console.error(error); }\n");
+        expect(scripts[1] == "user();");
+        expect(scripts[2] == "try {\nlast();\n} catch (error) { console.error(error); }\n");
+    };
+};
@@ -1,5 +1,7 @@
 #include "cfg.hpp"
 
+#include <map>
+
 #include <saucer/serializers/glaze/glaze.hpp>
 
 using namespace boost::ut;
@@ -16,4 +18,21 @@ suite serializer_suite = []
     static_assert(detail::type_name<int>() == "int");
     static_assert(detail::type_name<float>() == "float");
     static_assert(detail::type_name<a_struct>().ends_with("a_struct"));
+
+    "arguments"_test = []
+    {
+        using saucer::serializers::glaze;
+
+        std::string out;
+        glaze::serialize_arg(out, 10);
+        expect(out == R"(JSON.parse("10"))") << out;
+
+        out.clear();
+        glaze::serialize_arg(out, 10, true);
+        expect(out == "10") << out;
+
+        out.clear();
+        glaze::serialize_arg(out, std::map<std::string, int>{{"__proto__", 1}}, true);
+        expect(out == R"(JSON.parse("{\"__proto__\":1}"))") << out;
+    };
 };
@@ -0,0 +1,118 @@
+#include "cfg.hpp"
+
+#include <optional>
+
+#include <saucer/smartview.hpp>
+#include <saucer/utils/shared_state.hpp>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+struct counter
+{
+    int value;
+    std::vector<std::string> labels;
+};
+
+template <>
+struct glz::meta<counter>
+{
+    using T                     = counter;
+    static constexpr auto value = object( //
+        "value", &T::value,               //
+        "labels", &T::labels              //
+    );
+};
+
+suite shared_state_suite = []
+{
+    "diff"_test = []
+    {
+        glz::json_t from{};
+        glz::json_t to{};
+
+        expect(not glz::read_json(from, R"({"value": 1, "labels": ["a", "b"], "removed": true})"));
+        expect(not glz::read_json(to, R"({"value": 2, "labels": ["a"], "added": "x"})"));
+
+        std::vector<std::string> ops;
+        saucer::detail::state::diff(from, to, "", ops);
+
+        expect(eq(ops.size(), 4u));
+        expect(saucer::detail::state::apply(from, fmt::format("[{}]", fmt::join(ops, ","))));
+
+        expect(glz::write<saucer::detail::state::opts>(from).value_or("") ==
+               glz::write<saucer::detail::state::opts>(to).value_or(""));
+    };
+
+    "shared_state"_test = []
+    {
+        saucer::smartview smartview({.hardware_acceleration = false});
+        saucer::shared_state<counter> state{smartview, "counter", {.value = 1}};
+
+        expect(throws<std::invalid_argument>([&] { saucer::shared_state<counter>{smartview, "counter"}; }));
+
+        {
+            saucer::shared_state<counter> temporary{smartview, "temporary"};
+        }
+
+        expect(nothrow([&] { saucer::shared_state<counter>{smartview, "temporary"}; }));
+
+        state.on_change(
+            [&](const counter &current)
+            {
+                if (current.value != 42)
+                {
+                    return;
+                }
+
+                expect(eq(current.labels.size(), 1u));
+                smartview.close();
+            });
+
+        smartview.execute(R"js(
+            window.saucer.state('counter').then(state => state.update(value =>
+            {
+                value.value = 42;
+                value.labels.push('js');
+            }));
+        )js");
+
+        state.modify([](counter &value) { value.labels.clear(); });
+
+        smartview.set_url("https://saucer.github.io");
+        smartview.show();
+        smartview.run();
+
+        expect(eq(state.value().value, 42));
+    };
+
+    "outlived"_test = []
+    {
+        std::optional<saucer::shared_state<counter>> state;
+
+        {
+            saucer::smartview smartview({.hardware_acceleration = false});
+            state.emplace(smartview, "counter", counter{.value = 1});
+        }
+
+        //? The smartview is gone, changes only update the value from here on.
+
+        state->set({.value = 2});
+        expect(eq(state->value().value, 2));
+    };
+
+    "unchanged"_test = []
+    {
+        saucer::smartview smartview({.hardware_acceleration = false});
+        saucer::shared_state<counter> state{smartview, "counter", {.value = 1, .labels = {"a"}}};
+
+        const auto version = state.version();
+
+        state.modify([](counter &) {});
+        state.set({.value = 1, .labels = {"a"}});
+        expect(eq(state.version(), version));
+
+        state.modify([](counter &value) { value.labels.emplace_back("b"); });
+        expect(eq(state.version(), version + 1));
+    };
+};
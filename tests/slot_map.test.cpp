@@ -0,0 +1,149 @@
+#include "cfg.hpp"
+
+#include <slot_map.hpp>
+
+#include <map>
+#include <set>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <string>
+#include <vector>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+suite slot_map_suite = []
+{
+    static constexpr auto max_safe_integer = std::uint64_t{1} << 53;
+
+    "round_trip"_test = []
+    {
+        saucer::slot_map<int> map;
+
+        std::mutex mutex;
+        std::map<std::uint64_t, int> keys;
+
+        //? Every thread inserts into its own shard, so this covers keys of several shards.
+
+        std::vector<std::thread> threads;
+
+        for (auto t = 0; 8 > t; t++)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    for (auto i = 0; 1000 > i; i++)
+                    {
+                        auto value = (t * 1000) + i;
+                        auto key   = map.insert(value);
+
+                        std::lock_guard guard{mutex};
+                        keys.emplace(key, value);
+                    }
+                });
+        }
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        expect(eq(keys.size(), 8000u));
+        expect(eq(map.size(), 8000u));
+
+        for (const auto &[key, value] : keys)
+        {
+            expect(max_safe_integer > key);
+            expect(map.take(key) == value);
+        }
+
+        expect(eq(map.size(), 0u));
+    };
+
+    "stale_generation"_test = []
+    {
+        saucer::slot_map<std::string> map;
+
+        auto first = map.insert("first");
+        expect(map.take(first) == "first");
+
+        auto second = map.insert("second");
+
+        //? The slot is reused, but the old key must not match the new entry.
+
+        expect(neq(first, second));
+        expect(not map.take(first).has_value());
+        expect(not map.modify(first, [](auto &value) { value = "changed"; }));
+
+        expect(map.modify(second, [](auto &value) { value += "!"; }));
+        expect(map.take(second) == "second!");
+        expect(not map.take(second).has_value());
+    };
+
+    "safe_integer"_test = []
+    {
+        saucer::slot_map<int> map;
+
+        //? Churning a single slot keeps bumping its generation, keys still have to fit into a JS number.
+
+        for (auto i = 0; 100'000 > i; i++)
+        {
+            auto key = map.insert(i);
+
+            expect(max_safe_integer > key);
+            expect(map.take(key) == i);
+        }
+
+        auto key = map.insert(1);
+
+        expect(max_safe_integer > key);
+        expect(eq(static_cast<std::uint64_t>(static_cast<double>(key)), key));
+    };
+
+    "retired"_test = []
+    {
+        //? 4096 shards and 32 index bits leave 9 bits, and thus 512 generations, for a slot before it is retired.
+
+        auto map = std::make_unique<saucer::slot_map<int, 4096, 32>>();
+
+        std::set<std::uint64_t> keys;
+        std::vector<std::uint64_t> taken;
+
+        for (auto i = 0; 1000 > i; i++)
+        {
+            auto key = map->insert(i);
+
+            expect(max_safe_integer > key);
+            expect(keys.emplace(key).second) << "key was handed out twice";
+
+            expect(map->take(key) == i);
+            taken.emplace_back(key);
+        }
+
+        auto current = map->insert(-1);
+
+        for (const auto &key : taken)
+        {
+            expect(not map->take(key).has_value());
+        }
+
+        expect(map->take(current) == -1);
+    };
+
+    "take_if"_test = []
+    {
+        saucer::slot_map<int> map;
+
+        for (auto i = 0; 10 > i; i++)
+        {
+            map.insert(i);
+        }
+
+        auto even = map.take_if([](int value) { return value % 2 == 0; });
+
+        expect(eq(even.size(), 5u));
+        expect(eq(map.size(), 5u));
+        expect(eq(map.take_all().size(), 5u));
+    };
+};
@@ -2,6 +2,9 @@
 
 #include <array>
 #include <thread>
+#include <vector>
+#include <stdexcept>
+#include <functional>
 
 #include <saucer/smartview.hpp>
 #include <saucer/utils/future.hpp>
@@ -21,12 +24,93 @@ struct glz::meta<custom_type>
     static constexpr auto value = object("field", &T::field);
 };
 
+namespace
+{
+    //? Runs the given callback on a separate thread while the smartview runs its event loop. The smartview is closed
+    //? once the callback returns, even if it threw, so that one failing test can not keep the following ones from
+    //? running. By default the smartview is shown and navigates to a public page, `setup` may change that and always
+    //? runs before the callback.
+
+    using setup_t = std::function<void(saucer::smartview<> &)>;
+
+    void navigate(saucer::smartview<> &smartview)
+    {
+        smartview.set_url("https://saucer.github.io");
+        smartview.show();
+    }
+
+    template <typename Callback>
+    void with_smartview(Callback callback, const setup_t &setup = navigate)
+    {
+#ifdef _WIN32
+        std::this_thread::sleep_for(std::chrono::seconds(2));
+#endif
+
+        saucer::smartview smartview({.hardware_acceleration = false});
+        setup(smartview);
+
+        std::async(std::launch::deferred,
+                   [&]
+                   {
+                       try
+                       {
+                           callback(smartview);
+                       }
+                       catch (const std::exception &error)
+                       {
+                           expect(false) << error.what();
+                       }
+                       catch (...)
+                       {
+                           expect(false) << "unexpected exception";
+                       }
+
+                       smartview.close();
+                   }) |
+            saucer::forget();
+
+        smartview.run();
+    }
+
+    //? Waits for the result of an evaluation without hanging the test when it never arrives.
+
+    template <typename T>
+    T await(std::future<T> future)
+    {
+        using namespace std::chrono_literals;
+
+        if (future.wait_for(10s) != std::future_status::ready)
+        {
+            throw std::runtime_error{"evaluation did not finish in time"};
+        }
+
+        return future.get();
+    }
+
+    //? Serves a page whose content security policy forbids evaluating code and inline scripts, scripts sent by the
+    //? smartview must reach it regardless.
+
+    void serve_strict_csp(saucer::smartview<> &smartview)
+    {
+        smartview.handle("csp/",
+                         [](const saucer::scheme_request &, saucer::scheme_stream stream)
+                         {
+                             stream.start("text/html");
+                             stream.write(R"(<html><head><meta http-equiv="Content-Security-Policy" )"
+                                          R"(content="script-src 'self'"></head><body></body></html>)");
+                         });
+
+        smartview.serve("csp/index.html");
+        smartview.show();
+    }
+} // namespace
+
 suite smartview_suite = []
 {
     saucer::smartview smartview({.hardware_acceleration = false});
 
     std::size_t i{0};
-    std::array<std::promise<bool>, 6> called{};
+    std::array<std::promise<bool>, 7> called{};
     auto thread_id = std::this_thread::get_id();
 
     "evaluate"_test = [&]
@@ -83,9 +167,21 @@ suite smartview_suite = []
 
                 expect(utf8 == "測試-тест");
                 expect(smartview.evaluate<std::string>("'測試-тест'").get() == "測試-тест");
+                expect(eq(smartview.evaluate<int, "Math.pow({}, {})">(2, 2).get(), 4));
             },
             true);
 
+        smartview.expose(
+            "f5",
+            [&]
+            {
+                std::cout << "f5 called" << std::endl;
+                called[6].set_value(true);
+
+                expect(neq(std::this_thread::get_id(), thread_id));
+            },
+            saucer::policies::serial{"queue"});
+
         std::async(std::launch::deferred,
                    [&]
                    {
@@ -105,6 +201,13 @@ suite smartview_suite = []
                        expect(called[4].get_future().get());
                        expect(called[5].get_future().get());
 
+                       expect(not smartview.statistics("f1").has_value());
+                       expect(smartview.statistics("f4").has_value());
+
+                       smartview.evaluate<void>("window.saucer.call({}, [])", "f5").get();
+                       expect(called[6].get_future().get());
+                       expect(smartview.statistics("f5").has_value());
+
                        smartview.close();
                    }) |
             saucer::forget();
@@ -114,3 +217,313 @@ suite smartview_suite = []
     smartview.show();
     smartview.run();
 };
+
+suite smartview_features_suite = []
+{
+    "events"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                std::promise<bool> called;
+
+                smartview.expose("pong",
+                                 [&](int a, const std::string &b)
+                                 {
+                                     called.set_value(true);
+
+                                     expect(eq(a, 10));
+                                     expect(b == "hello!") << b;
+                                 });
+
+                smartview.execute("window.saucer.on('ping', (a, b) => window.saucer.exposed.pong(a, b))");
+
+                smartview.send_event("ping", 10, std::string{"hello!"});
+                expect(called.get_future().get());
+
+                auto arity = smartview.evaluate<std::string>(
+                    "await window.saucer.exposed.pong(10).then(() => 'called', () => 'rejected')");
+
+                expect(arity.get() == "rejected");
+            });
+    };
+
+    "channels"_test = []
+    {
+        using namespace std::chrono_literals;
+
+        //? Hidden windows never get an animation frame, the latest value still has to reach the page.
+
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                smartview.evaluate<void>("window.saucer.subscribe('tick', value => window.tick = value)").get();
+
+                for (auto i = 0; 10 > i; i++)
+                {
+                    smartview.publish("tick", i);
+                }
+
+                auto latest   = -1;
+                auto deadline = std::chrono::steady_clock::now() + 5s;
+
+                while (latest != 9 && std::chrono::steady_clock::now() < deadline)
+                {
+                    latest = smartview.evaluate<int>("window.tick ?? -1").get();
+                    std::this_thread::sleep_for(50ms);
+                }
+
+                expect(eq(latest, 9));
+            },
+            [](saucer::smartview<> &smartview) { smartview.set_url("https://saucer.github.io"); });
+    };
+
+    "priorities"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                smartview.expose("urgent", [] { return 1; }, saucer::policies::ui{}, saucer::priority::high);
+
+                auto urgent = smartview.evaluate<int>(
+                    saucer::priority::high, "await window.saucer.exposed.urgent.with({{ priority: 'low' }})()");
+
+                auto invalid = smartview.evaluate<std::string>(
+                    "await window.saucer.call('urgent', [], {{ priority: 'now' }}).then(() => '', e => e)");
+
+                expect(eq(urgent.get(), 1));
+                expect(invalid.get().starts_with("Bad Priority"));
+
+                auto large = std::string(200'000, 'x');
+                expect(eq(smartview.evaluate<std::size_t>(saucer::priority::low, "{}.length", large).get(),
+                          large.size()));
+
+                auto doubled = smartview.evaluate<int, "{} * 2">({.priority = saucer::priority::high}, 21);
+                expect(eq(doubled.get(), 42));
+            });
+    };
+
+    "strict_csp"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                await(smartview.evaluate<int>("1"));
+
+                auto large = std::string(200'000, 'x');
+                expect(eq(await(smartview.evaluate<std::size_t>(saucer::priority::low, "{}.length", large)),
+                          large.size()));
+
+                //? Large low priority results are sent to the page in pieces, which are parsed and not evaluated.
+
+                smartview.expose("large", [large] { return large; }, saucer::policies::ui{}, saucer::priority::low);
+                expect(eq(await(smartview.evaluate<std::size_t>("(await window.saucer.exposed.large()).length")),
+                          large.size()));
+            },
+            serve_strict_csp);
+    };
+
+    "strict_csp_pending"_test = []
+    {
+        //? Scripts issued before the DOM is ready are queued and flushed once it is, the page forbids 'unsafe-eval'.
+
+        std::future<int> queued;
+
+        with_smartview(
+            [&](saucer::smartview<> &smartview)
+            {
+                expect(eq(await(std::move(queued)), 42));
+                expect(await(smartview.evaluate<std::string>("window.queued")) == "user");
+            },
+            [&](saucer::smartview<> &smartview)
+            {
+                smartview.execute("const broken = (;");
+                smartview.execute("window.queued = 'user'");
+
+                queued = smartview.evaluate<int>("{} * 2", 21);
+
+                serve_strict_csp(smartview);
+            });
+    };
+
+    "admission"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                smartview.expose("limited", [] {});
+                expect(smartview.set_limits("limited", {.per_second = 0}));
+
+                auto limited = smartview.evaluate<std::string>(
+                    "await window.saucer.exposed.limited().then(() => 'called', () => 'rejected')");
+
+                expect(limited.get() == "rejected");
+                expect(eq(smartview.admission("limited")->rejected, 1u));
+            });
+    };
+
+    "objects"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                auto object = std::make_shared<custom_type>(custom_type{.field = 21});
+                auto twice  = [](custom_type &self) { return self.field * 2; };
+                auto handle = smartview.share(object, saucer::member{"twice", twice});
+
+                expect(eq(smartview.evaluate<int>("await window.saucer.remote({}).twice", handle).get(), 42));
+                smartview.release(handle);
+            });
+    };
+
+    "handles"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                auto element = smartview.evaluate<saucer::js_handle>("document.createElement('div')").get();
+                smartview.evaluate<void>("{}.id = 'handle'", element).get();
+
+                expect(smartview.evaluate<std::string>("{}.id", element).get() == "handle");
+
+                smartview.call<void>(element, "setAttribute", "title", "method").get();
+                expect(smartview.call<std::string>(element, "getAttribute", "title").get() == "method");
+
+                expect(smartview.release(element));
+                expect(not smartview.release(element));
+
+                expect(throws<saucer::exceptions::released>(
+                    [&] { smartview.evaluate<std::string>("{}.id", element).get(); }));
+                expect(throws<saucer::exceptions::released>(
+                    [&] { smartview.call<std::string>(element, "getAttribute", "id").get(); }));
+            });
+    };
+
+    "handles_navigation"_test = []
+    {
+        using namespace std::chrono_literals;
+
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                auto stale = await(smartview.evaluate<saucer::js_handle>("document.createElement('span')"));
+                smartview.set_url("https://saucer.github.io");
+
+                //? The handle is dropped once the navigation is noticed, until then it may still reach the old page.
+
+                auto released = false;
+                auto deadline = std::chrono::steady_clock::now() + 10s;
+
+                while (!released && std::chrono::steady_clock::now() < deadline)
+                {
+                    try
+                    {
+                        smartview.evaluate<std::string>("{}.tagName", stale).get();
+                    }
+                    catch (const saucer::exceptions::released &)
+                    {
+                        released = true;
+                    }
+                    catch (...)
+                    {
+                    }
+
+                    std::this_thread::sleep_for(50ms);
+                }
+
+                expect(released);
+                expect(not smartview.release(stale));
+            });
+    };
+
+    "abandon"_test = []
+    {
+        using namespace std::chrono_literals;
+        using clock = std::chrono::steady_clock;
+
+        //? The handler never returns on its own, the smartview has to give up on it once its timeout passes.
+
+        std::promise<void> started;
+        std::promise<void> unblock;
+
+        std::promise<std::vector<std::string>> abandoned;
+        clock::time_point closed;
+
+        with_smartview(
+            [&](saucer::smartview<> &smartview)
+            {
+                smartview.evaluate<void>("void window.saucer.exposed.stuck()").get();
+                expect(started.get_future().wait_for(10s) == std::future_status::ready);
+
+                closed = clock::now();
+            },
+            [&](saucer::smartview<> &smartview)
+            {
+                smartview.set_shutdown_timeout(200ms, [&](const auto &names) { abandoned.set_value(names); });
+
+                smartview.expose(
+                    "stuck",
+                    [&started, blocked = unblock.get_future().share()]
+                    {
+                        started.set_value();
+                        blocked.wait();
+                    },
+                    saucer::policies::pool{});
+
+                navigate(smartview);
+            });
+
+        auto result = abandoned.get_future();
+        auto ready  = result.wait_for(0s) == std::future_status::ready;
+
+        expect(ready);
+        expect(clock::now() - closed < 5s);
+
+        if (ready)
+        {
+            expect(result.get() == std::vector<std::string>{"stuck"});
+        }
+
+        unblock.set_value();
+    };
+
+    "definitions"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                auto add = smartview.define<int(int, int)>("add", "(a, b) => a + b");
+
+                expect(eq(add(1, 2).get(), 3));
+                expect(eq(add(20, 22).get(), 42));
+            });
+    };
+
+    "timeouts"_test = []
+    {
+        using namespace std::chrono_literals;
+
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                auto expiring = smartview.evaluate<int>({.timeout = 100ms}, "await new Promise(() => {{}})");
+
+                expect(throws<saucer::exceptions::timeout>([&] { expiring.get(); }));
+                expect(eq(smartview.evaluation_statistics().timed_out, 1u));
+            });
+    };
+
+    "navigation"_test = []
+    {
+        with_smartview(
+            [](saucer::smartview<> &smartview)
+            {
+                smartview.evaluate<void>("void 0").get();
+
+                auto hanging = smartview.evaluate<int>("await new Promise(() => {{}})");
+                smartview.set_url("https://saucer.github.io");
+
+                expect(throws<saucer::exceptions::navigation>([&] { hanging.get(); }));
+            });
+    };
+};
@@ -0,0 +1,74 @@
+#include "cfg.hpp"
+
+#include <timer.hpp>
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <future>
+
+using namespace boost::ut;
+using namespace boost::ut::literals;
+
+suite timer_suite = []
+{
+    using namespace std::chrono_literals;
+
+    "ordering"_test = []
+    {
+        saucer::timer timer;
+
+        std::mutex mutex;
+        std::vector<int> order;
+        std::promise<void> done;
+
+        auto push = [&](int value)
+        {
+            std::lock_guard guard{mutex};
+            order.emplace_back(value);
+        };
+
+        timer.schedule(60ms, [&] { push(3); });
+        timer.schedule(20ms, [&] { push(1); });
+        timer.schedule(40ms, [&] { push(2); });
+
+        auto cancelled = timer.schedule(30ms, [&] { push(0); });
+        timer.cancel(cancelled);
+
+        timer.schedule(80ms, [&] { done.set_value(); });
+
+        expect(done.get_future().wait_for(5s) == std::future_status::ready);
+
+        std::lock_guard guard{mutex};
+        expect(order == std::vector{1, 2, 3});
+    };
+
+    "stop"_test = []
+    {
+        saucer::timer timer;
+        std::atomic_bool ran{false};
+
+        expect(timer.finished());
+
+        timer.schedule(50ms, [&] { ran.store(true); });
+        expect(not timer.finished());
+
+        timer.stop();
+
+        for (auto i = 0; 500 > i && !timer.finished(); i++)
+        {
+            std::this_thread::sleep_for(10ms);
+        }
+
+        expect(timer.finished());
+
+        std::this_thread::sleep_for(100ms);
+        expect(not ran.load());
+
+        timer.schedule(0ms, [&] { ran.store(true); });
+        std::this_thread::sleep_for(50ms);
+
+        expect(not ran.load());
+    };
+};
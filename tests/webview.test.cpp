@@ -2,10 +2,9 @@
 
 #include <saucer/webview.hpp>
 
-#ifdef _WIN32
+#include <future>
 #include <thread>
 #include <chrono>
-#endif
 
 using namespace boost::ut;
 using namespace boost::ut::literals;
@@ -42,6 +41,32 @@ suite webview_suite = []
             expect(not webview.context_menu());
         };
 
+        "startup"_test = [&]
+        {
+            auto timings = webview.startup();
+
+            expect(timings.application.has_value() and timings.window.has_value() and timings.engine.has_value());
+            expect(*timings.application <= *timings.window and *timings.window <= *timings.engine);
+            expect(not timings.first_call.has_value());
+        };
+
+        "pending"_test = [&]
+        {
+            webview.set_pending_limit(2);
+
+            webview.execute("void 0;");
+            webview.execute("void 1;");
+            webview.execute("void 2;");
+
+            auto stats = webview.pending();
+
+            expect(eq(stats.scripts, 2u));
+            expect(eq(stats.bytes, 14u));
+            expect(eq(stats.dropped, 1u));
+
+            webview.set_pending_limit(4096);
+        };
+
         "navigation"_test = [&]
         {
             webview.set_url("https://www.wikipedia.com");
@@ -134,4 +159,78 @@ suite webview_suite = []
         webview.show();
         webview.run();
     };
+
+    "handlers"_test = [&]
+    {
+#ifdef _WIN32
+        std::this_thread::sleep_for(std::chrono::seconds(2));
+#endif
+        saucer::webview webview;
+
+        auto callback = [&](const std::string &url)
+        {
+            if (url.find("saucer") != std::string::npos)
+            {
+                return;
+            }
+
+            expect(url.find("startpage") != std::string::npos) << url;
+            webview.close();
+        };
+
+        webview.on<saucer::web_event::url_changed>(callback);
+
+        webview.handle("dynamic/",
+                       [](const saucer::scheme_request &request, saucer::scheme_stream stream)
+                       {
+                           expect(eq(request.path, std::string{"dynamic/test.html"}));
+
+                           stream.start("text/html");
+                           stream.write("<html><script>");
+                           stream.write(R"js(window.location.href = "https://startpage.com/";)js");
+                           stream.write("</script></html>");
+                       });
+
+        webview.serve("dynamic/test.html");
+
+        webview.show();
+        webview.run();
+    };
+
+    "abandoned_handlers"_test = [&]
+    {
+        using namespace std::chrono_literals;
+
+#ifdef _WIN32
+        std::this_thread::sleep_for(std::chrono::seconds(2));
+#endif
+
+        //? The handler never returns on its own, the webview has to give up on it once the timeout passes.
+
+        std::promise<void> unblock;
+        std::size_t abandoned{0};
+
+        {
+            saucer::webview webview;
+            webview.set_handler_timeout(200ms, [&](std::size_t count) { abandoned = count; });
+
+            webview.handle("stuck/",
+                           [&webview, blocked = unblock.get_future().share()](const saucer::scheme_request &,
+                                                                              saucer::scheme_stream stream)
+                           {
+                               stream.start("text/html");
+                               webview.close();
+
+                               blocked.wait();
+                           });
+
+            webview.serve("stuck/index.html");
+
+            webview.show();
+            webview.run();
+        }
+
+        expect(eq(abandoned, std::size_t{1}));
+        unblock.set_value();
+    };
 };
@@ -0,0 +1,343 @@
+#include <saucer/utils/embedded.hpp>
+
+#include <vector>
+#include <string>
+#include <optional>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <iostream>
+#include <iterator>
+#include <filesystem>
+#include <unordered_map>
+
+#ifdef SAUCER_EMBED_BROTLI
+#include <brotli/encode.h>
+#endif
+
+namespace fs = std::filesystem;
+
+//? Packs the files of a directory into one blob and generates the header and source that expose them to
+//? `webview::embed`. Invoked by `saucer_embed`, see "cmake/embed.cmake".
+//? Usage: saucer-embed <name> <symbol> <root> <file-list> <output> <incbin|array> <identity|brotli>
+//? The blob is exported as `<symbol>_blob`, so the symbol has to be unique among everything that is linked together.
+//? The table is named after it as well, so that targets that embed a directory under the same name do not clash.
+
+namespace
+{
+    constexpr auto alignment = 16u;
+
+    struct stored
+    {
+        std::size_t offset;
+        std::size_t size;
+
+      public:
+        bool compressed;
+    };
+
+    struct file
+    {
+        std::string path;
+        std::string mime;
+
+      public:
+        stored data;
+        std::size_t size;
+    };
+
+    std::string read(const fs::path &path)
+    {
+        std::ifstream stream{path, std::ios::binary};
+
+        if (!stream)
+        {
+            throw std::runtime_error("Failed to open " + path.string());
+        }
+
+        return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    }
+
+    //? Only touches the output if its content changed, so that translation units that include the generated header are
+    //? not rebuilt when an asset changes without moving any other asset.
+    void write(const fs::path &path, const std::string &content)
+    {
+        if (fs::exists(path) && read(path) == content)
+        {
+            return;
+        }
+
+        fs::create_directories(path.parent_path());
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+
+        stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    std::string literal(std::string_view value)
+    {
+        std::string rtn{"\""};
+
+        for (const auto &c : value)
+        {
+            const auto byte = static_cast<unsigned char>(c);
+
+            if (c == '"' || c == '\\')
+            {
+                rtn += '\\';
+                rtn += c;
+                continue;
+            }
+
+            if (byte < 0x20 || byte >= 0x7f)
+            {
+                //? Octal escapes never consume more than three digits, unlike hex escapes.
+                char escaped[5]{};
+                std::snprintf(escaped, sizeof(escaped), "\\%03o", byte);
+
+                rtn += escaped;
+                continue;
+            }
+
+            rtn += c;
+        }
+
+        return rtn + "\"";
+    }
+
+    std::string header(const std::string &name, const std::string &symbol, const std::vector<file> &files,
+                       std::size_t size)
+    {
+        std::vector<saucer::embedded_entry> entries;
+        entries.reserve(files.size());
+
+        for (const auto &file : files)
+        {
+            entries.emplace_back(saucer::embedded_entry{file.path, file.mime, {}});
+        }
+
+        std::vector<std::uint32_t> seeds(saucer::detail::embedded::bucket_count(files.size()));
+        std::vector<std::uint32_t> slots(saucer::detail::embedded::slot_count(files.size()));
+
+        saucer::detail::embedded::build(entries, seeds, slots);
+
+        const auto blob = symbol + "_blob";
+        std::ostringstream rtn;
+
+        rtn << "#pragma once\n\n"
+            << "#include <cstdint>\n"
+            << "#include <saucer/utils/embedded.hpp>\n\n"
+            << "// Generated by saucer_embed, do not edit.\n\n"
+            << "extern \"C\" const std::uint8_t " << blob << "[" << size << "];\n\n"
+            << "namespace saucer::embedded\n{\n"
+            << "    namespace detail\n    {\n"
+            << "        inline constexpr static_embedded_table<" << files.size() << "> " << symbol << "{\n"
+            << "            {{\n";
+
+        for (const auto &file : files)
+        {
+            rtn << "                embedded_entry{" << literal(file.path) << ", " << literal(file.mime) << ", {"
+                << blob << " + " << file.data.offset << ", " << file.data.size << "}";
+
+            if (file.data.compressed)
+            {
+                rtn << ", embedded_encoding::brotli, " << file.size;
+            }
+
+            rtn << "},\n";
+        }
+
+        rtn << "            }},\n            {";
+
+        for (const auto &seed : seeds)
+        {
+            rtn << seed << "u,";
+        }
+
+        rtn << "},\n            {";
+
+        for (const auto &slot : slots)
+        {
+            rtn << slot << "u,";
+        }
+
+        //? The accessor has internal linkage, every target only ever sees the table it embedded itself.
+
+        rtn << "},\n        };\n"
+            << "    } // namespace detail\n\n"
+            << "    static inline embedded_table " << name << "()\n    {\n"
+            << "        return detail::" << symbol << ";\n"
+            << "    }\n"
+            << "} // namespace saucer::embedded\n";
+
+        return rtn.str();
+    }
+
+    //? Compressed files are cached next to the output and only re-compressed when their source changes, so that changing
+    //? one asset does not re-compress the whole directory.
+    std::optional<std::string> compress([[maybe_unused]] const fs::path &source, [[maybe_unused]] const fs::path &cache,
+                                        [[maybe_unused]] const std::string &content)
+    {
+#ifdef SAUCER_EMBED_BROTLI
+        std::string rtn;
+
+        if (fs::exists(cache) && fs::last_write_time(cache) >= fs::last_write_time(source))
+        {
+            rtn = read(cache);
+        }
+        else
+        {
+            auto size = BrotliEncoderMaxCompressedSize(content.size());
+            rtn.resize(size);
+
+            const auto *input = reinterpret_cast<const std::uint8_t *>(content.data());
+            auto *output      = reinterpret_cast<std::uint8_t *>(rtn.data());
+
+            if (!BrotliEncoderCompress(BROTLI_MAX_QUALITY, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_GENERIC, content.size(),
+                                       input, &size, output))
+            {
+                throw std::runtime_error("Failed to compress " + source.string());
+            }
+
+            rtn.resize(size);
+            write(cache, rtn);
+        }
+
+        //? Already compressed formats (images, fonts, media) barely shrink, those are kept as they are so that they can
+        //? be served in place.
+        if (content.empty() || rtn.size() > content.size() - (content.size() / 10))
+        {
+            return std::nullopt;
+        }
+
+        return rtn;
+#else
+        throw std::runtime_error("saucer-embed was built without brotli support");
+#endif
+    }
+
+    std::string incbin(const std::string &symbol, const fs::path &blob)
+    {
+        auto path = blob.generic_string();
+        std::ostringstream rtn;
+
+        rtn << "// Generated by saucer_embed, do not edit.\n\n"
+            << "#if defined(__APPLE__)\n"
+            << "#define SAUCER_EMBED_SECTION \".const_data\\n\"\n"
+            << "#define SAUCER_EMBED_SYMBOL \"_" << symbol << "_blob\"\n"
+            << "#elif defined(_WIN32)\n"
+            << "#define SAUCER_EMBED_SECTION \".section .rdata, \\\"dr\\\"\\n\"\n"
+            << "#define SAUCER_EMBED_SYMBOL \"" << symbol << "_blob\"\n"
+            << "#else\n"
+            << "#define SAUCER_EMBED_SECTION \".section .rodata\\n\"\n"
+            << "#define SAUCER_EMBED_SYMBOL \"" << symbol << "_blob\"\n"
+            << "#endif\n\n"
+            << "asm(SAUCER_EMBED_SECTION\n"
+            << "    \".global \" SAUCER_EMBED_SYMBOL \"\\n\"\n"
+            << "    \".balign " << alignment << "\\n\"\n"
+            << "    SAUCER_EMBED_SYMBOL \":\\n\"\n"
+            << "    \".incbin \" " << literal(literal(path)) << " \"\\n\"\n"
+            << "    \".byte 0\\n\"\n"
+            << "    \".text\\n\");\n";
+
+        return rtn.str();
+    }
+
+    std::string array(const std::string &symbol, const std::string &blob)
+    {
+        std::ostringstream rtn;
+
+        rtn << "// Generated by saucer_embed, do not edit.\n\n"
+            << "#include <cstdint>\n\n"
+            << "extern \"C\" alignas(" << alignment << ") const std::uint8_t " << symbol << "_blob["
+            << blob.size() + 1 << "] = {";
+
+        for (auto i = 0u; blob.size() > i; i++)
+        {
+            rtn << (i % 32 == 0 ? "\n    " : "") << static_cast<unsigned>(static_cast<unsigned char>(blob[i])) << ",";
+        }
+
+        rtn << "\n    0};\n";
+
+        return rtn.str();
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc != 8)
+    {
+        std::cerr << "Usage: saucer-embed <name> <symbol> <root> <file-list> <output> <incbin|array> <identity|brotli>"
+                  << std::endl;
+        return 1;
+    }
+
+    const std::string name      = argv[1];
+    const std::string symbol    = argv[2];
+    const fs::path root         = argv[3];
+    const fs::path list         = argv[4];
+    const fs::path output       = argv[5];
+    const std::string_view mode = argv[6];
+    const bool compression      = std::string_view{argv[7]} == "brotli";
+
+    try
+    {
+        std::vector<file> files;
+        std::string blob;
+
+        //? Files with identical content share their bytes in the blob.
+        std::unordered_map<std::string, stored> contents;
+
+        std::istringstream paths{read(list)};
+
+        for (std::string path; std::getline(paths, path);)
+        {
+            if (path.empty())
+            {
+                continue;
+            }
+
+            const auto source = root / fs::path{path};
+
+            auto content = read(source);
+            auto size    = content.size();
+
+            auto it = contents.find(content);
+
+            if (it == contents.end())
+            {
+                std::optional<std::string> compressed;
+
+                if (compression)
+                {
+                    compressed = compress(source, output / "compressed" / (path + ".br"), content);
+                }
+
+                const auto &payload = compressed ? *compressed : content;
+                auto data           = stored{blob.size(), payload.size(), compressed.has_value()};
+
+                blob.append(payload);
+                blob.resize((blob.size() + alignment - 1) / alignment * alignment, '\0');
+
+                it = contents.emplace(std::move(content), data).first;
+            }
+
+            files.emplace_back(file{path, std::string{saucer::detail::embedded::mime(path)}, it->second, size});
+        }
+
+        //? The symbol is always followed by one byte so that it is never zero-sized.
+        const auto blob_path = output / "blob.bin";
+
+        write(blob_path, blob);
+        write(output / "include" / "saucer" / "embedded" / (name + ".hpp"),
+              header(name, symbol, files, blob.size() + 1));
+        write(output / (name + ".cpp"),
+              mode == "array" ? array(symbol, blob) : incbin(symbol, fs::absolute(blob_path)));
+    }
+    catch (const std::exception &error)
+    {
+        std::cerr << "[saucer] Failed to embed files: " << error.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}